@@ -10,21 +10,107 @@
 #define LIFE_H
 
 #include <stdlib.h>
+#include <stdint.h>
+
+/**
+ * @brief Per-rank statistics returned by the step kernels.
+ *
+ * Every kernel fills these counters in the same sweep that writes `next`,
+ * so the termination checks need no extra pass over the slab.
+ */
+typedef struct {
+    long alive;     // alive cells in the new generation
+    long births;    // cells that went dead → alive
+    long deaths;    // cells that went alive → dead
+    int  changed;   // 1 if at least one cell changed (births + deaths > 0)
+} life_stats_t;
+
+/**
+ * @brief Store the counters of a step into `stats`.
+ *
+ * The one place that defines `changed`: a generation changed iff it had at
+ * least one birth or death.
+ */
+void life_stats_set(life_stats_t *stats, long alive, long births, long deaths);
+
+/**
+ * @brief Number of boards of an ensemble: one per bit of a 64-bit word.
+ */
+#define LIFE_LANES 64
+
+/**
+ * @brief Per-lane counterpart of life_stats_t for the ensemble step.
+ */
+typedef struct {
+    long alive[LIFE_LANES];     // alive cells of every lane in the new generation
+    uint64_t changed;           // bit k set if lane k had at least one birth or death
+} life_lanes_t;
+
+/**
+ * @brief Default fraction of alive cells of a random board (-d).
+ */
+#define LIFE_DENSITY 0.5
 
 /**
  * @brief Initialize and Allocate and initialize a random board (plain, size rows×cols).
  *
  * This function returns a flat array of size rows*cols. Each entry is 0 (dead)
- * or 1 (alive), chosen at random. It guarantees at least one alive cell
- * (rejection sampling if the first draw yields zero alive).
+ * or 1 (alive), drawn with life_random(). It guarantees at least one alive
+ * cell (the next attempt of the stream is drawn while every cell is dead).
  *
- * @param rows Number of rows in the board (without ghost).
- * @param cols Number of columns in the board.
- * @param seed Random seed (passed to rand_r). If seed == 0, uses time(NULL).
+ * @param rows    Number of rows in the board (without ghost).
+ * @param cols    Number of columns in the board.
+ * @param seed    Random seed (key of the stream). If seed == 0, uses time(NULL).
+ * @param density Probability that a cell is alive, in (0, 1].
  * @return Pointer to a flat array of chars of length rows*cols.
  *         Caller must free() this buffer with life_destroy().
  */
-char* life_create(int rows, int cols, unsigned int seed);
+char* life_create(int rows, int cols, unsigned int seed, double density);
+
+/**
+ * @brief Draw rows of a random board from a counter-based stream (Philox4x32-10).
+ *
+ * Cell (r, j) of a board with `cols` columns is alive when 32-bit word
+ * r*cols + j of the stream keyed by (seed, attempt) is below density·2^32.
+ * A cell depends on nothing but its global index, so any band of rows can be
+ * drawn on its own, in any order, and the board is the same however it is
+ * split among ranks.
+ *
+ * @param cells     OUT: first cell of row first_row; rows are `stride` chars apart.
+ * @param first_row Global index of the first row to draw.
+ * @param rows      Number of rows to draw.
+ * @param cols      Number of columns of the whole board.
+ * @param stride    Distance between two rows of `cells` (cols, or a padded pitch).
+ * @param seed      Random seed of the board.
+ * @param attempt   Index of the draw (a board with no alive cell is drawn again with attempt + 1).
+ * @param density   Probability that a cell is alive, in (0, 1].
+ * @return Number of alive cells drawn.
+ */
+long life_random(char *cells, long first_row, int rows, int cols, size_t stride,
+                 unsigned int seed, unsigned int attempt, double density);
+
+/**
+ * @brief Packed counterpart of life_random(): the same cells, one bit per cell.
+ *
+ * @param words  OUT: first word of row first_row (life_packed_words(cols) words per row, overwritten).
+ * @param stride Distance in words between two rows of `words`.
+ * @return Number of alive cells drawn (other parameters as in life_random()).
+ */
+long life_random_packed(uint64_t *words, long first_row, int rows, int cols, size_t stride,
+                        unsigned int seed, unsigned int attempt, double density);
+
+/**
+ * @brief Ensemble counterpart of life_random(): the same cells in bit `lane` of one word per cell.
+ *
+ * The other bits of every word are left untouched, so the lanes of an
+ * ensemble can be drawn one after the other (lane k with seed + k).
+ *
+ * @param words IN/OUT: word of cell (first_row, 0); rows are `stride` words apart.
+ * @param lane  Bit of every word that receives the cell, in [0, LIFE_LANES).
+ * @return Number of alive cells drawn (other parameters as in life_random()).
+ */
+long life_random_lane(uint64_t *words, long first_row, int rows, int cols, size_t stride, int lane,
+                      unsigned int seed, unsigned int attempt, double density);
 
 /**
  * @brief Destroy a board previously allocated by life_create_random.
@@ -40,32 +126,490 @@ void life_destroy(char *board);
  * @param size  Total number of cells (rows*cols).
  * @return Total number of cells equal to 1.
  */
-long life_count(const char *board, int size);
+long life_count(const char *board, size_t size);
+
+/**
+ * @brief Load a pattern file as a plain board (size rows×cols).
+ *
+ * Accepts plaintext (.cells: 'O' or '*' alive, '!' comment lines) and RLE
+ * ('#' comment lines, "x = ..." header, b/o/$ runs ended by '!'). The board
+ * is the bounding box of the rows and columns described in the file.
+ *
+ * @param path Path of the pattern file.
+ * @param rows OUT: number of rows of the pattern.
+ * @param cols OUT: number of columns of the pattern.
+ * @return Pointer to a flat array of chars of length rows*cols (0 or 1), or
+ *         NULL if the file cannot be read or is empty.
+ *         Caller must free() this buffer with life_destroy().
+ */
+char* life_load(const char *path, int *rows, int *cols);
+
+/**
+ * @brief Alignment (in bytes) of padded buffers and of their row pitch: one cache line.
+ */
+#define LIFE_ALIGN 64
+
+/**
+ * @brief Row pitch of a padded buffer.
+ *
+ * A padded row holds a left ghost column, the cols real cells, a right ghost
+ * column and zero padding up to a multiple of LIFE_ALIGN bytes, so every row
+ * starts on a cache line. Cell (i,j) of the slab lives at buf[i*pitch + j + 1].
+ *
+ * @param cols Number of columns in the board.
+ * @return Bytes per padded row: cols + 2 rounded up to LIFE_ALIGN.
+ */
+int life_pitch(int cols);
+
+/**
+ * @brief Allocate a zeroed, LIFE_ALIGN-aligned padded buffer.
+ *
+ * The buffer has rows+2 rows (two ghost rows) of life_pitch(cols) bytes;
+ * ghost rows, ghost columns and padding all start at 0 (dead).
+ *
+ * @param rows Number of real rows (excludes ghost).
+ * @param cols Number of columns.
+ * @return Pointer to (rows+2)*life_pitch(cols) bytes, or NULL on failure.
+ *         Caller must free() this buffer with life_destroy().
+ */
+char* life_alloc(int rows, int cols);
+
+/**
+ * @brief Rectangle of the unbounded plane held by the slabs of all ranks (grow engine).
+ *
+ * Rows row..row+rows-1 are split across the ranks as in mpi_scatter_board(),
+ * every rank holding all the cols columns; every cell outside is dead.
+ */
+typedef struct {
+    long row, col;      // plane coordinates of the top-left cell
+    int rows, cols;     // extent of the window
+} life_window_t;
+
+/**
+ * @brief Bounding box of the alive cells of a padded slab.
+ *
+ * Only the real rows 1..rows of buf are scanned (ghost rows are ignored).
+ *
+ * @param buf   Padded board of size (rows+2)*pitch.
+ * @param rows  Number of real rows (excludes ghost).
+ * @param cols  Number of columns.
+ * @param pitch Bytes per padded row (life_pitch(cols)).
+ * @param box   OUT: top row, left column, bottom row and right column of the
+ *              alive cells (0-based, slab coordinates); { rows, cols, -1, -1 }
+ *              if every cell is dead.
+ */
+void life_bounds(const char *buf, int rows, int cols, int pitch, int box[4]);
+
+/**
+ * @brief Check whether any alive cell lies on the border of a padded slab.
+ *
+ * Looks at the first and last real columns of every row, plus the whole
+ * first and/or last real row, in O(rows + cols) instead of a full scan.
+ *
+ * @param buf    Padded board of size (rows+2)*pitch.
+ * @param rows   Number of real rows (excludes ghost).
+ * @param cols   Number of columns.
+ * @param pitch  Bytes per padded row (life_pitch(cols)).
+ * @param top    Non-zero to check the first real row as well.
+ * @param bottom Non-zero to check the last real row as well.
+ * @return 1 if an alive cell touches the checked border, 0 otherwise.
+ */
+int life_edge_alive(const char *buf, int rows, int cols, int pitch, int top, int bottom);
+
+/**
+ * @brief Boundary conditions of the board: what the cells beyond its edges are.
+ *
+ * The kernels never test for an edge: they read the ghost rows and columns
+ * of the padded slab, which hold whatever the boundary makes of the cells
+ * beyond the board (life_fill_edges() for the ghost columns, the ghost row
+ * exchange for the ghost rows).
+ */
+enum {
+    LIFE_BOUNDARY_CYLINDER = 0,  // rows wrap around across ranks, columns beyond the sides are dead (default)
+    LIFE_BOUNDARY_TORUS    = 1,  // rows and columns wrap around
+    LIFE_BOUNDARY_DEAD     = 2,  // every cell beyond the board is dead (bounded plane)
+    LIFE_BOUNDARY_REFLECT  = 3,  // every cell beyond an edge mirrors the cell on the edge
+    LIFE_BOUNDARY_COUNT
+};
+
+/**
+ * @brief Name of a boundary condition, as accepted on the command line.
+ *
+ * @param boundary One of the LIFE_BOUNDARY_* values.
+ * @return Static string ("cylinder", "torus", "dead", "reflect"), or NULL if out of range.
+ */
+const char* life_boundary_name(int boundary);
+
+/**
+ * @brief Fill the ghost cells of a padded slab that the boundary derives from its own cells.
+ *
+ * Called after the ghost row exchange, once per generation. Torus: the ghost
+ * columns of every row (ghost rows included, so the corners wrap both ways)
+ * copy the opposite real column. Reflect: the ghost rows at the top and
+ * bottom of the board copy the first and last real rows, then the ghost
+ * columns copy the first and last real columns. Cylinder and dead leave the
+ * ghost columns dead. Each mode is a separate branch-free loop of
+ * O(rows) cells.
+ *
+ * @param buf      Padded board of size (rows+2)*pitch, ghost rows exchanged.
+ * @param rows     Number of real rows (excludes ghost).
+ * @param cols     Number of columns.
+ * @param pitch    Bytes per padded row (life_pitch(cols)).
+ * @param boundary One of the LIFE_BOUNDARY_* values.
+ * @param top      Non-zero if the slab holds the first row of the board.
+ * @param bottom   Non-zero if the slab holds the last row of the board.
+ */
+void life_fill_edges(char *buf, int rows, int cols, int pitch, int boundary, int top, int bottom);
+
+/**
+ * @brief Life-like rule as an 18-bit mask (B/S notation).
+ *
+ * Bit n (n = 0..8) is set if a dead cell with n alive neighbors is born,
+ * bit 9 + n if an alive cell with n alive neighbors survives, so the next
+ * state is a single shift: LIFE_RULE_NEXT(rule, is_alive, n).
+ */
+#define LIFE_RULE(birth, survive) ((unsigned)(birth) | ((unsigned)(survive) << 9))
+
+#define LIFE_RULE_LIFE     LIFE_RULE(0x008, 0x00C)  // B3/S23, Conway's Life (default)
+#define LIFE_RULE_HIGHLIFE LIFE_RULE(0x048, 0x00C)  // B36/S23
+#define LIFE_RULE_DAYNIGHT LIFE_RULE(0x1C8, 0x1D8)  // B3678/S34678
+#define LIFE_RULE_SEEDS    LIFE_RULE(0x004, 0x000)  // B2/S
+
+/**
+ * @brief Next state (0 or 1) of a cell with `n` alive neighbors under `rule`, branch-free.
+ */
+#define LIFE_RULE_NEXT(rule, is_alive, n) (((rule) >> ((n) + 9 * (is_alive))) & 1)
+
+/**
+ * @brief Compile a rulestring such as "B36/S23" into a rule mask.
+ *
+ * Accepts "B<digits>/S<digits>" (either order, case-insensitive, digits 0..8,
+ * either list may be empty). Rules with B0 are rejected: they would make the
+ * dead cells around the board come alive, which no engine represents.
+ *
+ * @param text Rulestring from the command line.
+ * @param rule OUT: rule mask (see LIFE_RULE()).
+ * @return 0 on success, -1 if the string is malformed or contains B0.
+ */
+int life_parse_rule(const char *text, unsigned *rule);
+
+/**
+ * @brief Format a rule mask in canonical B/S notation (e.g., "B36/S23").
+ *
+ * @param rule Rule mask (see LIFE_RULE()).
+ * @param buf  Output buffer, at least 24 bytes.
+ */
+void life_format_rule(unsigned rule, char *buf);
+
+/**
+ * @brief Select the rule applied by life_step() and by every engine.
+ *
+ * Must be called before life_select_kernel(): the byte kernels have variants
+ * specialized for B3/S23, B36/S23, B3678/S34678 and B2/S (rule constants
+ * folded into branch-free compares) and a generic variant for any other
+ * rule. If never called, the rule is LIFE_RULE_LIFE.
+ *
+ * @param rule Rule mask (see LIFE_RULE()), without B0.
+ */
+void life_set_rule(unsigned rule);
+
+/**
+ * @brief Rule selected with life_set_rule() (LIFE_RULE_LIFE by default).
+ */
+unsigned life_get_rule(void);
 
 /**
  * @brief Compute one generation of Game of Life on a padded buffer.
  *
  * This function assumes that `current` and `next` are buffers of size
- * (rows+2) * cols. Rows 0 and rows+1 are “ghost rows” (popolate esternamente).
- * The actual data lives in rows 1..rows. For each cell (i,j) with
- * 1 <= i <= rows, 0 <= j < cols, we count its eight neighbors (handling
- * left/right columns via simple index checks, i.e., no wrap-around). The rules:
+ * (rows+2) * pitch (see life_pitch()/life_alloc()). Rows 0 and rows+1 are
+ * “ghost rows” (popolate esternamente), column 0 and cols+1 of every padded
+ * row are “ghost columns” that stay 0, so cells outside the board are dead
+ * and no bounds check is needed (no wrap-around). The actual data lives in
+ * rows 1..rows, columns 1..cols. The rules (B3/S23, unless another rule
+ * was selected with life_set_rule()):
  *
  *   - If a cell is alive and has fewer than 2 alive neighbors → dies.
  *   - If a cell is alive and has 2 or 3 alive neighbors → stays alive.
  *   - If a cell is alive and has more than 3 alive neighbors → dies.
  *   - If a cell is dead and has exactly 3 alive neighbors → becomes alive.
  *
- * All updates are written to the `next` buffer, which must also be size
- * (rows+2) * cols. Ghost rows of `next` (row 0 and row rows+1) are not set
- * by this function (they will be overwritten by MPI ghost exchanges).
+ * All updates are written to the `next` buffer, which must have the same
+ * layout. Ghost rows, ghost columns and padding of `next` are not set by
+ * this function (ghost rows will be overwritten by MPI ghost exchanges).
+ *
+ * The kernel is fused: while writing `next` it also counts the alive cells
+ * of the new generation, births and deaths, and reports them in `stats`.
  *
- * @param current Pointer to current board of size (rows+2)*cols.
- * @param next    Pointer to buffer for next board, size (rows+2)*cols.
+ * The work is delegated to the kernel chosen with life_select_kernel()
+ * (by default the widest SIMD kernel supported by the CPU).
+ *
+ * @param current Pointer to current board of size (rows+2)*pitch.
+ * @param next    Pointer to buffer for next board, size (rows+2)*pitch.
  * @param rows    Number of real rows (excludes ghost).
  *                Valid data in `current` is in rows 1..rows.  
  * @param cols    Number of columns.
+ * @param pitch   Bytes per padded row (life_pitch(cols)).
+ * @param stats   OUT: population and transitions of this sweep (not NULL).
+ */
+void life_step(const char *current, char *next, int rows, int cols, int pitch,
+               life_stats_t *stats);
+
+/**
+ * @brief Implementations of life_step() on the byte (char-per-cell) layout.
+ *
+ * All kernels produce bit-identical results; they only differ in how many
+ * cells are processed per instruction. LIFE_KERNEL_AUTO resolves at runtime
+ * (CPUID) to the widest SIMD kernel supported by the host (never to colsum/lut).
+ */
+enum {
+    LIFE_KERNEL_AUTO   = 0,  // best supported kernel (avx2 > sse2 > scalar)
+    LIFE_KERNEL_SCALAR = 1,  // portable per-cell loop
+    LIFE_KERNEL_SSE2   = 2,  // 16 cells per iteration (x86 SSE2)
+    LIFE_KERNEL_AVX2   = 3,  // 32 cells per iteration (x86 AVX2)
+    LIFE_KERNEL_COLSUM = 4,  // running column sums + sliding 3-wide window
+    LIFE_KERNEL_LUT    = 5,  // 4×4 → 2×2 lookup table (life_lut_init())
+    LIFE_KERNEL_COUNT
+};
+
+/**
+ * @brief Name of a kernel, as accepted on the command line.
+ *
+ * @param kernel One of the LIFE_KERNEL_* values.
+ * @return Static string ("auto", "scalar", "sse2", "avx2", "colsum", "lut"), or NULL if out of range.
+ */
+const char* life_kernel_name(int kernel);
+
+/**
+ * @brief Select the kernel used by subsequent life_step() calls.
+ *
+ * If never called, life_step() behaves as if LIFE_KERNEL_AUTO was selected.
+ * The variant of the kernel matching the rule of life_set_rule() is used.
+ *
+ * @param kernel One of the LIFE_KERNEL_* values.
+ * @return The kernel actually selected (AUTO is resolved to a concrete kernel),
+ *         or -1 if the kernel is unknown or not supported by this CPU.
+ */
+int life_select_kernel(int kernel);
+
+/**
+ * @brief Release the scratch kept by the kernels between calls (colsum row).
+ *
+ * Call once the board is freed; a later life_step() allocates it again.
+ */
+void life_kernel_release(void);
+
+/**
+ * @brief Portable per-cell implementation of life_step() (LIFE_KERNEL_SCALAR).
+ */
+void life_step_scalar(const char *current, char *next, int rows, int cols, int pitch,
+                      life_stats_t *stats);
+
+/**
+ * @brief SSE2 implementation of life_step() (LIFE_KERNEL_SSE2).
+ *
+ * Neighbor sums of 16 cells are accumulated with byte additions of shifted
+ * unaligned loads; the rules are applied with byte compares. Ghost columns
+ * cover the borders, only a row tail shorter than a vector is done per cell.
+ * Only available on x86 builds.
+ */
+void life_step_sse2(const char *current, char *next, int rows, int cols, int pitch,
+                    life_stats_t *stats);
+
+/**
+ * @brief AVX2 implementation of life_step() (LIFE_KERNEL_AVX2), 32 cells at once.
+ *
+ * Same scheme as life_step_sse2(). Only available on x86 builds and must only
+ * be called on hosts reporting AVX2 (see life_select_kernel()).
+ */
+void life_step_avx2(const char *current, char *next, int rows, int cols, int pitch,
+                    life_stats_t *stats);
+
+/**
+ * @brief Sliding-window implementation of life_step() (LIFE_KERNEL_COLSUM).
+ *
+ * Keeps the vertical sum of rows i-1, i, i+1 for every column in a small
+ * scratch row, updated incrementally (add row i+2, drop row i-1) while moving
+ * down the slab. Each cell's count is a horizontal 3-wide window over those
+ * sums minus the cell itself, slid one column at a time: about 3 loads per
+ * cell instead of 8. The scratch row is allocated once and kept, grown to
+ * the widest board seen, until life_kernel_release(); like the rule and the
+ * selected kernel it is shared by the whole process, so the kernel is not
+ * reentrant. Uses the same padded buffer contract as life_step().
+ */
+void life_step_colsum(const char *current, char *next, int rows, int cols, int pitch,
+                      life_stats_t *stats);
+
+/**
+ * @brief Build the 65536-entry block table used by the lookup-table kernels.
+ *
+ * Entry `idx` is the next 2×2 center of the 4×4 block whose cell (r,c) is bit
+ * r*4 + c of idx, under the rule of life_set_rule(). Built once per rule
+ * (later calls return immediately); selecting LIFE_KERNEL_LUT builds it at startup.
+ */
+void life_lut_init(void);
+
+/**
+ * @brief Lookup-table implementation of life_step() (LIFE_KERNEL_LUT).
+ *
+ * Walks the slab in 2×2 output blocks: the 4×4 window around each block is
+ * packed into a 16-bit index (as rolling nibbles, two new columns per block)
+ * and the next 2×2 center comes from a single table lookup. An odd last row
+ * or column is done per cell. Uses the same padded buffer contract as life_step().
+ */
+void life_step_lut(const char *current, char *next, int rows, int cols, int pitch,
+                   life_stats_t *stats);
+
+/**
+ * @brief Advance a padded buffer by two generations with the block table.
+ *
+ * Unlike life_step(), `current` needs two ghost rows above and below the
+ * slab: the buffer has rows+4 padded rows of `pitch` bytes and the real rows
+ * are 2..rows+1 (ghost columns as in life_step()). Every 4×4 output block is
+ * computed from the 8×8 block around it: 9 lookups give generation +1 on
+ * the 6×6 core (columns outside the board forced dead), 4 more lookups give
+ * generation +2 on the 4×4 center. Only real rows/columns of `next` are set.
+ *
+ * `stats` describes the last generation: alive cells at +2, and births,
+ * deaths and changed between generation +1 and +2. The population of the
+ * intermediate generation goes to gen_alive[0] (and that of +2 to
+ * gen_alive[1]), so callers can still tell a period-2 oscillator apart
+ * from a steady population.
+ *
+ * @param current   Pointer to current board of size (rows+4)*pitch.
+ * @param next      Pointer to buffer for the board two generations later, same size.
+ * @param rows      Number of real rows (excludes the 2+2 ghost rows).
+ * @param cols      Number of columns.
+ * @param pitch     Bytes per padded row (life_pitch(cols)).
+ * @param stats     OUT: population and transitions of the second generation.
+ * @param gen_alive OUT: alive cells at +1 and +2 (2 entries), or NULL.
+ */
+void life_step2_lut(const char *current, char *next, int rows, int cols, int pitch,
+                    life_stats_t *stats, long *gen_alive);
+
+/**
+ * @brief Rows of the band updated per life_step() call by life_step_inplace().
+ */
+#define LIFE_INPLACE_ROWS 8
+
+/**
+ * @brief Advance a padded buffer by one generation in place.
+ *
+ * Same contract as life_step() with `next` == `current`: rows are rewritten
+ * in bands of LIFE_INPLACE_ROWS, and only the original rows the stencil
+ * still needs are kept in a small ring of LIFE_INPLACE_ROWS + 2 rows (the
+ * last original row above the band, the band itself and the row below).
+ * The band is computed by the selected kernel straight into `buf`, so the
+ * slab needs a single buffer instead of current + next, plus the ring,
+ * allocated once by the caller with life_alloc(LIFE_INPLACE_ROWS, cols).
+ *
+ * @param buf   Padded board of size (rows+2)*pitch, ghost rows filled; rows
+ *              1..rows are replaced by the next generation.
+ * @param ring  Scratch of LIFE_INPLACE_ROWS + 2 padded rows; its contents
+ *              need not be preserved between calls.
+ * @param rows  Number of real rows (excludes ghost).
+ * @param cols  Number of columns.
+ * @param pitch Bytes per padded row (life_pitch(cols)).
+ * @param stats OUT: population and transitions of this sweep (not NULL).
+ */
+void life_step_inplace(char *buf, char *ring, int rows, int cols, int pitch, life_stats_t *stats);
+
+/**
+ * @brief Number of 64-bit words needed to store one packed row.
+ *
+ * In the packed representation bit b of word w holds column 64*w + b.
+ * Unused high bits of the last word are always kept at 0.
+ *
+ * @param cols Number of columns in the board.
+ * @return Number of uint64_t words per row, i.e. ceil(cols / 64).
+ */
+int life_packed_words(int cols);
+
+/**
+ * @brief Pack a plain board (e.g. from life_load()) into rows of 64-bit words.
+ *
+ * @param board Flat array of rows*cols chars, 0 (dead) or 1 (alive).
+ * @param rows  Number of rows in the board.
+ * @param cols  Number of columns in the board.
+ * @return Pointer to a flat array of rows*life_packed_words(cols) words, or NULL.
+ *         Caller must free() this buffer with life_destroy_packed().
+ */
+uint64_t* life_pack(const char *board, int rows, int cols);
+
+/**
+ * @brief Destroy a packed board (life_pack(), life_spread() or a packed slab).
+ *
+ * @param board Pointer returned by life_pack() or life_spread().
+ */
+void life_destroy_packed(uint64_t *board);
+
+/**
+ * @brief Count alive cells in a packed board (popcount of every word).
+ *
+ * @param board  Pointer to a flat array of words.
+ * @param nwords Total number of words to scan.
+ * @return Total number of bits set to 1.
+ */
+long life_count_packed(const uint64_t *board, size_t nwords);
+
+/**
+ * @brief Compute one generation of Game of Life on a padded packed buffer.
+ *
+ * Packed counterpart of life_step(). Each padded row has a stride of
+ * life_packed_words(cols) + 2 words: word 0 and the last word are “ghost words”
+ * that stay 0 (dead columns outside the board), the real words sit in between.
+ * Rows 0 and rows+1 are ghost rows (filled by mpi_exchange_ghosts_packed()).
+ *
+ * A whole word (64 cells) is updated at once: the eight neighbor bitmaps are
+ * built with shifts and summed with bitwise half/full adders, then the rules
+ * are applied on the resulting bit-planes (alive next iff count == 3, or
+ * count == 2 and alive now). Other rules complete the count to four
+ * bit-planes and OR the planes matching each count of the rule.
+ * The ghost words and rows of `next` are not set.
+ * Population, births and deaths are popcounted in the same sweep.
+ *
+ * @param current Pointer to current packed board of (rows+2)*stride words.
+ * @param next    Pointer to buffer for next packed board, same size.
+ * @param rows    Number of real rows (excludes ghost).
+ * @param cols    Number of columns (bits per row actually used).
+ * @param stats   OUT: population and transitions of this sweep (not NULL).
+ */
+void life_step_packed(const uint64_t *current, uint64_t *next, int rows, int cols,
+                      life_stats_t *stats);
+
+/**
+ * @brief Copy a plain board (e.g. from life_load()) into all the lanes of an ensemble.
+ *
+ * @param board Flat array of rows*cols chars, 0 (dead) or 1 (alive).
+ * @param rows  Number of rows in the board.
+ * @param cols  Number of columns in the board.
+ * @return Pointer to a flat array of rows*cols words (0 or all ones), or NULL.
+ *         Caller must free() this buffer with life_destroy_packed().
+ */
+uint64_t* life_spread(const char *board, int rows, int cols);
+
+/**
+ * @brief Compute one generation of LIFE_LANES independent boards at once.
+ *
+ * Same padded layout as life_step_packed() with life_packed_words(cols)
+ * replaced by cols: every cell is a word whose bit k belongs to board k, so
+ * the eight neighbors are the adjacent words (no shifts) and the same
+ * bitwise adders advance the 64 boards together. Lanes outside `active`
+ * keep their state (a board that met an early-exit condition is frozen
+ * while the others go on).
+ *
+ * The population of every lane is accumulated in bit-sliced counters
+ * (one bit-plane per bit of the 64 counts, a ripple carry per word) and
+ * unpacked once per sweep.
+ *
+ * @param current Pointer to current board of (rows+2)*(cols+2) words.
+ * @param next    Pointer to buffer for the next board, same size.
+ * @param rows    Number of real rows (excludes ghost).
+ * @param cols    Number of columns.
+ * @param active  Lanes to advance.
+ * @param lanes   OUT: population of every lane and mask of the lanes that changed.
  */
-void life_step(const char *current, char *next, int rows, int cols);
+void life_step_ensemble(const uint64_t *current, uint64_t *next, int rows, int cols, uint64_t active,
+                        life_lanes_t *lanes);
 
 #endif // LIFE_H
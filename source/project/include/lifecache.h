@@ -0,0 +1,87 @@
+//    _____      _     ___                             __                __       
+//   |_   _|    (_)  .' ..]                           [  |              [  |      
+//     | |      __  _| |_  .---.  .---.  ,--.   .---.  | |--.  .---.     | |--.   
+//     | |   _ [  |'-| |-'/ /__\\/ /'`\]`'_\ : / /'`\] | .-. |/ /__\\    | .-. |  
+//    _| |__/ | | |  | |  | \__.,| \__. // | |,| \__.  | | | || \__., _  | | | |  
+//   |________|[___][___]  '.__.''.___.'\'-;__/'.___.'[___]|__]'.__.'(_)[___]|__] 
+//                                                                                
+
+#ifndef LIFECACHE_H
+#define LIFECACHE_H
+
+#include <stdint.h>
+#include "life.h"
+
+/**
+ * @brief Side of the tiles memoized by life_step_memo() (output cells per side).
+ *
+ * The key of a tile is its 8×8 cells plus a 1-cell border: 10×10 = 100 bits.
+ */
+#define LIFE_MEMO_TILE 8
+
+/**
+ * @brief Default number of entries of the memo cache (about 2.5 MiB).
+ */
+#define LIFE_MEMO_CAPACITY (1 << 16)
+
+/**
+ * @brief Bounded LRU cache mapping a 10×10 neighborhood to the next 8×8 tile.
+ *
+ * Entries live in flat arrays, chained per hash bucket and linked in a
+ * doubly linked recency list; when the cache is full the least recently used
+ * entry is evicted. Allocated with life_memo_create(), released with
+ * life_memo_destroy().
+ */
+typedef struct {
+    int capacity;           // maximum number of entries
+    int count;              // entries in use
+    int mask;               // buckets - 1 (power of two)
+    int *bucket;            // first entry of every bucket chain (-1 if empty)
+    uint64_t *key;          // two words per entry: rows 0-5 and rows 6-9 of the 10×10 block
+    uint64_t *value;        // next 8×8 tile, bit 8*i + j = cell (i, j)
+    int *chain;             // next entry in the same bucket (-1 at the end)
+    int *newer, *older;     // recency list (-1 at the ends)
+    int newest, oldest;     // ends of the recency list (-1 if empty)
+    long hits;              // lookups answered by the cache
+    long empty;             // lookups of empty blocks, answered without the cache
+    long misses;            // lookups that had to compute the tile
+} life_memo_t;
+
+/**
+ * @brief Allocate an empty memo cache.
+ *
+ * @param capacity Maximum number of entries (> 0).
+ * @return Pointer to the cache, or NULL on failure.
+ *         Caller must free it with life_memo_destroy().
+ */
+life_memo_t* life_memo_create(int capacity);
+
+/**
+ * @brief Destroy a cache allocated by life_memo_create().
+ *
+ * @param memo Pointer returned by life_memo_create() (may be NULL).
+ */
+void life_memo_destroy(life_memo_t *memo);
+
+/**
+ * @brief Compute one generation tile by tile through the memo cache.
+ *
+ * Same buffer contract as life_step(). The slab is cut into 8×8 tiles; the
+ * 10×10 block around each tile (cells outside the buffer read as dead) is
+ * packed into a 100-bit key and looked up in `memo`. On a miss the next
+ * tile is computed from the key and inserted, evicting the least recently
+ * used entry when the cache is full. Only real rows/columns of `next` are
+ * written; population, births and deaths are popcounted from the tiles.
+ *
+ * @param memo    Cache shared by all steps (hit/miss counters accumulate).
+ * @param current Pointer to current board of size (rows+2)*pitch.
+ * @param next    Pointer to buffer for next board, size (rows+2)*pitch.
+ * @param rows    Number of real rows (excludes ghost).
+ * @param cols    Number of columns.
+ * @param pitch   Bytes per padded row (life_pitch(cols)).
+ * @param stats   OUT: population and transitions of this sweep (not NULL).
+ */
+void life_step_memo(life_memo_t *memo, const char *current, char *next, int rows, int cols,
+                    int pitch, life_stats_t *stats);
+
+#endif // LIFECACHE_H
@@ -0,0 +1,82 @@
+//    _____      _     ___             __         __   _             __       
+//   |_   _|    (_)  .' ..]           |  ]       [  | / |_          [  |      
+//     | |      __  _| |_  .---.   .--.| | .---.  | |`| |-',--.      | |--.   
+//     | |   _ [  |'-| |-'/ /__\\/ /'`\' |/ /__\\ | | | | `'_\ :     | .-. |  
+//    _| |__/ | | |  | |  | \__.,| \__/  || \__., | | | |,// | |, _  | | | |  
+//   |________|[___][___]  '.__.' '.__.;__]'.__.'[___]\__/\'-;__/(_)[___]|__] 
+//                                                                            
+
+#ifndef LIFEDELTA_H
+#define LIFEDELTA_H
+
+#include <stddef.h>
+#include "life.h"
+
+/**
+ * @brief Event-driven slab: cell states plus persistent neighbor counts.
+ *
+ * Instead of recomputing every cell, life_step_delta() works from the list
+ * of cells that flipped in the previous generation: each flip adjusts the
+ * counts of its 8 neighbors, and only the cells whose count changed (and
+ * the flipped cells themselves) are evaluated again. Flips in the first and
+ * last real rows are what the neighbor ranks need for their ghost rows, so
+ * mpi_exchange_ghosts_delta() sends those columns instead of whole rows.
+ *
+ * Cell (i, j) of the slab is index i*cols + j of cell, count and queued.
+ */
+typedef struct {
+    int rows;                   // real rows of the slab
+    int cols;                   // number of columns (cells outside 0..cols-1 are dead)
+    unsigned char *cell;        // rows*cols states, 0 or 1
+    unsigned char *count;       // rows*cols alive neighbors (ghost rows included)
+    unsigned char *queued;      // rows*cols marks: cell already in the candidate list
+    unsigned char *ghost[2];    // states of the row above (0) and below (1), cols each
+    size_t *flips;              // cells that flipped in the last generation
+    size_t flip_count, flip_capacity;
+    size_t *candidates;         // cells to evaluate in the current generation
+    size_t candidate_capacity;
+    int *edge_flips[2];         // columns of the first (0) and last (1) real row in flips
+    int edge_flip_count[2];
+    int *ghost_flips[2];        // columns flipped in the row above (0) and below (1), from the neighbors
+    int ghost_flip_count[2];
+    long alive;                 // alive cells of the slab
+} life_delta_t;
+
+/**
+ * @brief Build an event-driven slab from the real rows of a padded byte buffer.
+ *
+ * Counts start at zero and every alive cell is recorded as a flip (dead →
+ * alive), so the first life_step_delta() builds the counts with the same
+ * code as every later generation, in time proportional to the population.
+ *
+ * @param buf   Padded buffer (rows+2)*pitch laid out as by life_alloc().
+ * @param rows  Number of real rows.
+ * @param cols  Number of columns.
+ * @param pitch Bytes per padded row (life_pitch(cols)).
+ * @return Pointer to the slab, or NULL on failure.
+ *         Caller must free it with life_delta_destroy().
+ */
+life_delta_t* life_delta_create(const char *buf, int rows, int cols, int pitch);
+
+/**
+ * @brief Destroy a slab allocated by life_delta_create().
+ *
+ * @param delta Pointer returned by life_delta_create() (may be NULL).
+ */
+void life_delta_destroy(life_delta_t *delta);
+
+/**
+ * @brief Compute one generation in place from the last flips.
+ *
+ * Applies the flips of the previous generation (own rows and the ghost
+ * flips received from the neighbors) to the neighbor counts, evaluates the
+ * cells whose count changed, then flips the cells whose state changes.
+ * The cost is proportional to the number of flips, not to rows*cols.
+ *
+ * @param delta Slab, ghost flips filled by mpi_exchange_ghosts_delta().
+ * @param stats OUT: population, births, deaths and change flag of the new generation.
+ * @return 0 on success, -1 if the candidate or flip lists could not grow.
+ */
+int life_step_delta(life_delta_t *delta, life_stats_t *stats);
+
+#endif // LIFEDELTA_H
@@ -0,0 +1,210 @@
+//    _____      _     ___             __   __                     __          __       
+//   |_   _|    (_)  .' ..]           |  ] [  |                   [  |        [  |      
+//     | |      __  _| |_  .---.   .--.| |  | |--.   ,--.   .--.   | |--.      | |--.   
+//     | |   _ [  |'-| |-'/ /__\\/ /'`\' |  | .-. | `'_\ : ( (`\]  | .-. |     | .-. |  
+//    _| |__/ | | |  | |  | \__.,| \__/  |  | | | | // | |, `'.'.  | | | |  _  | | | |  
+//   |________|[___][___]  '.__.' '.__.;__][___]|__]\'-;__/[\__) )[___]|__](_)[___]|__] 
+//                                                                                      
+
+#ifndef LIFEDHASH_H
+#define LIFEDHASH_H
+
+#include <mpi.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Global name of a distributed HashLife node.
+ *
+ * Owned nodes carry their level, their owner rank and their slot in the
+ * owner's node table (bits 56-61, 36-55 and 0-35). Two kinds of node are
+ * encoded inline (bit 63 set) and never stored: the 4×4 leaves, whose 16
+ * cells are the low bits (cell (r, c) is bit r*4 + c), and the all-dead
+ * square of every level above 2 (bit 62 set, level in the low bits). Every
+ * rank can therefore test for an empty square, or read a leaf, without
+ * asking anybody.
+ */
+typedef uint64_t life_dnode_t;
+
+#define LIFE_DHASH_NONE ((life_dnode_t)UINT64_MAX)
+
+/**
+ * @brief Highest quadtree level (side 2^level); keeps coordinates in int64_t.
+ */
+#define LIFE_DHASH_MAX_LEVEL 60
+
+/**
+ * @brief Record of an owned node in its owner's table.
+ */
+typedef struct {
+    life_dnode_t child[4];  // nw, ne, sw, se quadrants (level - 1)
+    life_dnode_t result;    // center 2^(level-1) square after 2^(level-2) generations
+    life_dnode_t step;      // center square after 2^step_log generations (step_log < level-2)
+    uint64_t population;    // alive cells, UINT64_MAX until first asked for
+    uint32_t next;          // next node in the same hash bucket, or in the free list
+    uint32_t task;          // task computing result/step/population, or UINT32_MAX
+    uint8_t flags;          // LIVE and MARK bits (node table bookkeeping)
+} life_dhash_node_t;
+
+/**
+ * @brief One request or reply between ranks (5 words on the wire).
+ *
+ * op packs the message kind (bits 0-7), the slot of the awaited value in
+ * the requesting task (bits 8-15) and the requesting task (bits 16-47).
+ */
+typedef struct {
+    uint64_t op;
+    uint64_t arg[4];
+} life_dhash_msg_t;
+
+/**
+ * @brief Computation of one memoized value on the rank that owns the node.
+ *
+ * A RESULT task walks through the states of the HashLife recursion; each
+ * state sends out a batch of requests (children of remote nodes, joins,
+ * results of sub-squares) and resumes once all replies are in.
+ */
+typedef struct {
+    life_dnode_t node;          // square the value belongs to
+    int kind;                   // RESULT or POPULATION
+    int state;                  // step of the recursion reached so far
+    int pending;                // replies still awaited by the current state
+    uint32_t waiters;           // first of the requests to answer when done
+    life_dnode_t child[4];      // quadrants of the node
+    life_dnode_t gc[16];        // grandchildren, 4×4 grid
+    life_dnode_t ggc[64];       // great-grandchildren, 8×8 grid (slower than full speed)
+    life_dnode_t sub[9];        // nine overlapping sub-squares of half size
+    life_dnode_t r[9];          // their centers, advanced (or not) for the first half
+    life_dnode_t q[4];          // regrouped into four squares
+    uint64_t s[4];              // their advanced centers (or the children populations)
+    life_dnode_t out;           // final value
+} life_dhash_task_t;
+
+/**
+ * @brief A request waiting for a task (answered by rank, task and slot).
+ */
+typedef struct {
+    int rank;           // requesting rank, or -1 to broadcast the value to every rank
+    uint32_t target;    // requesting task
+    uint32_t slot;      // slot of the value in that task
+    uint32_t next;      // next waiter of the same task, or in the free list
+} life_dhash_waiter_t;
+
+/**
+ * @brief Distributed HashLife universe: this rank's share of the node table.
+ *
+ * Same algorithm as life_hash_t, with the quadtree spread over the ranks of
+ * comm: a node is stored only by the rank its four children hash to, so the
+ * node table (and the memoized results) use the memory of every rank. Work
+ * follows the data: the result of a node is computed by its owner, which
+ * asks the owners of the sub-squares for theirs. Ranks advance in
+ * bulk-synchronous supersteps: drain local work, then one all-to-all
+ * exchange carries every request and reply of the superstep.
+ *
+ * All life_dhash_* functions are collective over comm.
+ */
+typedef struct {
+    life_dhash_node_t *nodes;   // node table of this rank
+    uint32_t *bucket;           // first node of every hash chain
+    size_t capacity;            // allocated nodes (power of two, also the bucket count)
+    size_t max_nodes;           // memory cap on capacity
+    size_t count;               // high-water mark of used node slots
+    size_t live;                // nodes currently in the table
+    uint32_t free_list;         // slots released by the last collection
+    int full;                   // set when a node could not be allocated
+    int step_log;               // generations (log2) memoized in the `step` fields
+
+    life_dnode_t root;          // current universe (same on every rank)
+    int64_t origin_row;         // board coordinates of the root's top-left cell
+    int64_t origin_col;
+    long collections;           // garbage collections run so far
+    long supersteps;            // all-to-all exchanges run so far
+
+    MPI_Comm comm;
+    int rank;
+    int size;
+
+    life_dhash_task_t **tasks;  // task slots (allocated once, reused)
+    uint32_t *task_free;        // released task slots
+    size_t task_count, task_capacity, task_free_count;
+    uint32_t *ready;            // tasks whose replies are all in
+    size_t ready_count, ready_capacity;
+    life_dhash_waiter_t *waiters;
+    uint32_t waiter_free;
+    size_t waiter_count, waiter_capacity;
+
+    life_dhash_msg_t **outbox;  // messages for every rank (this rank's: local replies)
+    size_t *outbox_count;
+    size_t *outbox_capacity;
+    uint64_t *send;             // outboxes packed for the exchange
+    long send_capacity;
+    uint64_t *recv;
+    long recv_capacity;
+    int *send_counts;
+    int *recv_counts;
+
+    life_dnode_t *batch;        // reply targets of life_dhash_load() joins
+    int keep_results;           // collection in progress keeps results
+    int done;                   // value of the current computation arrived
+    uint64_t done_value;
+} life_dhash_t;
+
+/**
+ * @brief Allocate an empty universe whose local node table may grow to max_bytes.
+ *
+ * @param max_bytes Memory cap of this rank's node table and its buckets.
+ * @param comm      Communicator of the ranks sharing the universe.
+ * @return Pointer to the universe, or NULL on failure.
+ *         Caller must free it with life_dhash_destroy().
+ */
+life_dhash_t* life_dhash_create(size_t max_bytes, MPI_Comm comm);
+
+/**
+ * @brief Destroy a universe allocated by life_dhash_create().
+ *
+ * @param hash Pointer returned by life_dhash_create() (may be NULL).
+ */
+void life_dhash_destroy(life_dhash_t *hash);
+
+/**
+ * @brief Replace the universe with a plain rows×cols board held by MASTER.
+ *
+ * MASTER cuts the board into leaves and sends the joins of every level in
+ * one batch to their owners.
+ *
+ * @param hash  Universe from life_dhash_create().
+ * @param board On MASTER: flat array of rows*cols chars, 0 or 1. Others: NULL.
+ * @param rows  Number of rows of the board (same on every rank).
+ * @param cols  Number of columns of the board (same on every rank).
+ * @return 0 on success, -1 (on every rank) if the board does not fit in the node tables.
+ */
+int life_dhash_load(life_dhash_t *hash, const char *board, int rows, int cols);
+
+/**
+ * @brief Advance the universe by 2^log2_gens generations at once.
+ *
+ * Same contract as life_hash_advance(): the root is padded until the
+ * pattern cannot reach its border, full node tables are collected, and a
+ * jump that still does not fit is split in two halves.
+ *
+ * @param hash      Universe from life_dhash_create().
+ * @param log2_gens Generations to advance, as a power of two (0 ≤ log2_gens < LIFE_DHASH_MAX_LEVEL - 3).
+ * @return 0 on success, -1 (on every rank) if the node tables are too small even for single generations.
+ */
+int life_dhash_advance(life_dhash_t *hash, int log2_gens);
+
+/**
+ * @brief Alive cells of the universe (same value on every rank).
+ */
+uint64_t life_dhash_population(life_dhash_t *hash);
+
+/**
+ * @brief Collect the nodes not reachable from the root on every rank.
+ *
+ * @param hash         Universe from life_dhash_create().
+ * @param keep_results Non-zero to keep memoized results (and the nodes they
+ *                     reference); zero to drop them and free more nodes.
+ */
+void life_dhash_collect(life_dhash_t *hash, int keep_results);
+
+#endif // LIFEDHASH_H
@@ -0,0 +1,129 @@
+//    _____      _     ___        __                     __          __       
+//   |_   _|    (_)  .' ..]      [  |                   [  |        [  |      
+//     | |      __  _| |_  .---.  | |--.   ,--.   .--.   | |--.      | |--.   
+//     | |   _ [  |'-| |-'/ /__\\ | .-. | `'_\ : ( (`\]  | .-. |     | .-. |  
+//    _| |__/ | | |  | |  | \__., | | | | // | |, `'.'.  | | | |  _  | | | |  
+//   |________|[___][___]  '.__.'[___]|__]\'-;__/[\__) )[___]|__](_)[___]|__] 
+//                                                                            
+
+#ifndef LIFEHASH_H
+#define LIFEHASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Index of a node in the HashLife node table.
+ *
+ * Nodes 0 and 1 are the level-0 leaves (dead and alive cell).
+ */
+typedef uint32_t life_node_t;
+
+#define LIFE_HASH_DEAD  ((life_node_t)0)
+#define LIFE_HASH_ALIVE ((life_node_t)1)
+#define LIFE_HASH_NONE  ((life_node_t)UINT32_MAX)
+
+/**
+ * @brief Highest quadtree level (side 2^level); keeps coordinates in int64_t.
+ */
+#define LIFE_HASH_MAX_LEVEL 60
+
+/**
+ * @brief Canonical quadtree node: a 2^level × 2^level square of cells.
+ */
+typedef struct {
+    life_node_t child[4];   // nw, ne, sw, se quadrants (level - 1)
+    life_node_t next;       // next node in the same hash bucket, or in the free list
+    life_node_t result;     // center 2^(level-1) square after 2^(level-2) generations
+    life_node_t step;       // center square after 2^step_log generations (step_log < level-2)
+    uint8_t level;          // side 2^level
+    uint8_t flags;          // LIVE and MARK bits (node table bookkeeping)
+    uint64_t population;    // alive cells in the square
+} life_hash_node_t;
+
+/**
+ * @brief HashLife universe: node table, hash buckets and the current root.
+ *
+ * Every square is stored once (hash-consed on its four children), and the
+ * result of advancing a square is memoized in the node itself, so repeated
+ * regions are computed once at every scale. The table grows up to max_nodes;
+ * life_hash_advance() collects unreachable nodes when it fills up.
+ *
+ * Unlike the slab engines (dead columns, rows wrapping across ranks), the
+ * universe is an unbounded plane: the board is placed with its top-left cell
+ * at (origin_row, origin_col) = (0, 0) and everything around it is dead.
+ */
+typedef struct {
+    life_hash_node_t *nodes;    // node table (0 and 1 are the leaves)
+    life_node_t *bucket;        // first node of every hash chain
+    size_t capacity;            // allocated nodes (power of two, also the bucket count)
+    size_t max_nodes;           // memory cap on capacity
+    size_t count;               // high-water mark of used node slots
+    size_t live;                // nodes currently in the table
+    life_node_t free_list;      // slots released by the last collection
+    life_node_t empty[LIFE_HASH_MAX_LEVEL + 1];   // canonical all-dead node of every level
+    int full;                   // set when a node could not be allocated
+    int step_log;               // generations (log2) memoized in the `step` fields
+    life_node_t root;           // current universe
+    int64_t origin_row;         // board coordinates of the root's top-left cell
+    int64_t origin_col;
+    long collections;           // garbage collections run so far
+} life_hash_t;
+
+/**
+ * @brief Allocate an empty universe whose node table may grow to max_bytes.
+ *
+ * @param max_bytes Memory cap of the node table and its buckets.
+ * @return Pointer to the universe, or NULL on failure.
+ *         Caller must free it with life_hash_destroy().
+ */
+life_hash_t* life_hash_create(size_t max_bytes);
+
+/**
+ * @brief Destroy a universe allocated by life_hash_create().
+ *
+ * @param hash Pointer returned by life_hash_create() (may be NULL).
+ */
+void life_hash_destroy(life_hash_t *hash);
+
+/**
+ * @brief Replace the universe with a plain rows×cols board (e.g. from life_create()).
+ *
+ * @param hash  Universe from life_hash_create().
+ * @param board Flat array of rows*cols chars, 0 (dead) or 1 (alive).
+ * @param rows  Number of rows of the board.
+ * @param cols  Number of columns of the board.
+ * @return 0 on success, -1 if the board does not fit in the node table.
+ */
+int life_hash_load(life_hash_t *hash, const char *board, int rows, int cols);
+
+/**
+ * @brief Advance the universe by 2^log2_gens generations at once.
+ *
+ * The root is padded with dead space until the pattern cannot reach its
+ * border, then replaced by its memoized center after 2^log2_gens
+ * generations. When the node table is full, unreachable nodes are collected
+ * and the memoized results dropped; if that is still not enough the jump is
+ * done as two jumps of half the size.
+ *
+ * @param hash      Universe from life_hash_create().
+ * @param log2_gens Generations to advance, as a power of two (0 ≤ log2_gens < LIFE_HASH_MAX_LEVEL - 3).
+ * @return 0 on success, -1 if the node table is too small even for single generations.
+ */
+int life_hash_advance(life_hash_t *hash, int log2_gens);
+
+/**
+ * @brief Alive cells of the universe.
+ */
+uint64_t life_hash_population(const life_hash_t *hash);
+
+/**
+ * @brief Collect the nodes not reachable from the root (or from the empty nodes).
+ *
+ * @param hash         Universe from life_hash_create().
+ * @param keep_results Non-zero to keep memoized results (and the nodes they
+ *                     reference); zero to drop them and free more nodes.
+ */
+void life_hash_collect(life_hash_t *hash, int keep_results);
+
+#endif // LIFEHASH_H
@@ -0,0 +1,126 @@
+//    _____      _     ___        __                   _             __       
+//   |_   _|    (_)  .' ..]      [  |                 (_)           [  |      
+//     | |      __  _| |_  .---.  | | .---.  _ .--.   __   ,--.      | |--.   
+//     | |   _ [  |'-| |-'/ /__\\ | |/ /__\\[ `.-. | [  | `'_\ :     | .-. |  
+//    _| |__/ | | |  | |  | \__., | || \__., | | | |  | | // | |, _  | | | |  
+//   |________|[___][___]  '.__.'[___]'.__.'[___||__][___]\'-;__/(_)[___]|__] 
+//                                                                            
+
+#ifndef LIFELENIA_H
+#define LIFELENIA_H
+
+#include <complex.h>
+#include "life.h"
+
+/**
+ * @brief Largest kernel radius accepted in a Lenia rule.
+ */
+#define LIFE_LENIA_MAX_RADIUS 256
+
+/**
+ * @brief Default Lenia rule: Orbium (R = 13, T = 10, mu = 0.15, sigma = 0.015).
+ */
+#define LIFE_LENIA_ORBIUM { 13, 10, 0.15, 0.015 }
+
+/**
+ * @brief Lenia rule: continuous states, smooth ring kernel, Gaussian growth.
+ *
+ * Every cell holds a state in [0, 1]. The potential U of a cell is its
+ * neighborhood weighted by the ring kernel K(r) = exp(4 - 1/(r(1-r))) of
+ * r = distance/R (normalized to sum 1), and the state moves by
+ * dt * G(U), dt = 1/T, with G(u) = 2 exp(-(u-mu)^2 / (2 sigma^2)) - 1,
+ * clipped to [0, 1].
+ */
+typedef struct {
+    int radius;         // R: kernel radius in cells, 1..LIFE_LENIA_MAX_RADIUS
+    int steps;          // T: time steps per unit of time (dt = 1/T)
+    double mu;          // center of the growth function
+    double sigma;       // width of the growth function
+} life_lenia_rule_t;
+
+/**
+ * @brief Lenia slab with its FFT convolution workspace.
+ *
+ * States are floats, rows of `cols` values with no ghost columns (the
+ * columns beyond the board are zero padding of the transforms), and
+ * `radius` ghost rows on each side filled by mpi_exchange_ghosts_lenia():
+ * cell (i, j) is cell[(i + radius) * cols + j]. The convolution runs on
+ * blocks of `block` rows (a power of two) overlapping by 2R rows
+ * (overlap-save): each block yields block - 2R rows of potential.
+ */
+typedef struct {
+    life_lenia_rule_t rule;     // rule being run
+    int rows;                   // real rows of the slab
+    int cols;                   // number of columns
+    int radius;                 // ghost rows per side (= rule.radius)
+    float *cell;                // (rows + 2R) * cols states of the current generation
+    float *next;                // same layout, receives the next generation
+    int block;                  // rows per transform block (power of two)
+    int width;                  // columns per transform (power of two >= cols + R)
+    double *kernel;             // block * (width/2 + 1) real spectrum of the kernel (symmetric)
+    double complex *spectrum;   // block * (width/2 + 1) half spectrum of the current block
+    double complex *line;       // max(block, width) scratch line
+    double complex *roots;      // twiddle factors: width/2 forward and width/2 inverse for the rows,
+                                // then block/2 forward and block/2 inverse for the columns
+} life_lenia_t;
+
+/**
+ * @brief Compile a Lenia rulestring into a rule.
+ *
+ * Accepts "R<radius>,T<steps>,M<mu>,S<sigma>", e.g. "R13,T10,M0.15,S0.015"
+ * (Orbium, see LIFE_LENIA_ORBIUM).
+ *
+ * @param text Rulestring (case-insensitive).
+ * @param rule OUT: compiled rule (unchanged on failure).
+ * @return 0 on success, -1 if `text` is not a valid Lenia rule.
+ */
+int life_lenia_parse_rule(const char *text, life_lenia_rule_t *rule);
+
+/**
+ * @brief Write the rulestring of `rule` into `buf` (at least 64 bytes).
+ */
+void life_lenia_format_rule(const life_lenia_rule_t *rule, char *buf);
+
+/**
+ * @brief Build a Lenia slab from the real rows of a padded byte buffer.
+ *
+ * Alive cells start at state 1, dead cells at 0. The kernel spectrum and
+ * the twiddle factors are computed once here.
+ *
+ * @param buf   Padded buffer (rows+2)*pitch laid out as by life_alloc().
+ * @param rows  Number of real rows (>= rule->radius).
+ * @param cols  Number of columns.
+ * @param pitch Bytes per padded row (life_pitch(cols)).
+ * @param rule  Rule to run (copied).
+ * @return Pointer to the slab, or NULL on failure.
+ *         Caller must free it with life_lenia_destroy().
+ */
+life_lenia_t* life_lenia_create(const char *buf, int rows, int cols, int pitch, const life_lenia_rule_t *rule);
+
+/**
+ * @brief Destroy a slab allocated by life_lenia_create().
+ *
+ * @param lenia Pointer returned by life_lenia_create() (may be NULL).
+ */
+void life_lenia_destroy(life_lenia_t *lenia);
+
+/**
+ * @brief Compute one generation (one time step dt) of the Lenia slab.
+ *
+ * For every block of rows: the states (ghost rows included) go through a
+ * forward 2D real-to-complex FFT, are multiplied by the kernel spectrum and
+ * come back through the inverse FFT; the rows whose whole neighborhood lies
+ * inside the block give the potential of their cells. The cost per cell is
+ * O(log(block * width)), independent of the kernel radius apart from the
+ * 2R rows of overlap per block. The generations then swap inside `lenia`.
+ *
+ * A cell counts as alive while its state is above zero; births and deaths
+ * are the cells leaving and reaching zero, and the change flag is raised if
+ * any state moved.
+ *
+ * @param lenia Slab, ghost rows filled by mpi_exchange_ghosts_lenia().
+ * @param stats OUT: population, births, deaths and change flag of the new generation.
+ */
+void life_step_lenia(life_lenia_t *lenia, life_stats_t *stats);
+
+#endif // LIFELENIA_H
@@ -0,0 +1,74 @@
+//    _____      _     ___        __    _          _      __       
+//   |_   _|    (_)  .' ..]      [  |  (_)        / |_   [  |      
+//     | |      __  _| |_  .---.  | |  __   .--. `| |-'   | |--.   
+//     | |   _ [  |'-| |-'/ /__\\ | | [  | ( (`\] | |     | .-. |  
+//    _| |__/ | | |  | |  | \__., | |  | |  `'.'. | |, _  | | | |  
+//   |________|[___][___]  '.__.'[___][___][\__) )\__/(_)[___]|__] 
+//                                                                 
+
+#ifndef LIFELIST_H
+#define LIFELIST_H
+
+#include <stddef.h>
+#include "life.h"
+
+/**
+ * @brief Sparse slab: the sorted columns of the alive cells of every row.
+ *
+ * Row i (0 ≤ i < rows) holds cell[start[i] .. start[i+1]-1], in increasing
+ * order. The two ghost rows (the rows above and below the slab, filled by
+ * mpi_exchange_ghosts_list()) are kept apart in ghost[0] and ghost[1]. The
+ * memory and the work per generation are proportional to the population;
+ * only the ghost rows and the merge scratch are sized by cols.
+ */
+typedef struct {
+    int rows;               // real rows of the slab
+    int cols;               // number of columns (cells outside 0..cols-1 are dead)
+    size_t *start;          // rows+1 offsets into cell
+    int *cell;              // alive columns, row after row
+    size_t capacity;        // allocated entries of cell
+    int *ghost[2];          // alive columns of the row above (0) and below (1), cols entries each
+    int ghost_count[2];     // alive cells in each ghost row
+    int *merge_col;         // scratch: columns alive in any of three rows (cols entries)
+    unsigned char *merge_w; // scratch: alive count among the three rows, plus 4 if alive in the middle row
+} life_list_t;
+
+/**
+ * @brief Build a sparse slab from the real rows of a padded byte buffer.
+ *
+ * @param buf   Padded buffer (rows+2)*pitch laid out as by life_alloc(), or
+ *              NULL for an empty slab.
+ * @param rows  Number of real rows.
+ * @param cols  Number of columns.
+ * @param pitch Bytes per padded row (life_pitch(cols)).
+ * @return Pointer to the slab, or NULL on failure.
+ *         Caller must free it with life_list_destroy().
+ */
+life_list_t* life_list_create(const char *buf, int rows, int cols, int pitch);
+
+/**
+ * @brief Destroy a slab allocated by life_list_create().
+ *
+ * @param list Pointer returned by life_list_create() (may be NULL).
+ */
+void life_list_destroy(life_list_t *list);
+
+/**
+ * @brief Compute one generation of a sparse slab.
+ *
+ * For every row the alive columns of the rows above, at and below it are
+ * merged into one sorted list with per-column counts; only the columns next
+ * to an alive cell are candidates, and a sliding window over the merged
+ * list gives their neighbor count. Rows without any alive cell around them
+ * cost nothing beyond reading three empty ranges. Population, births and
+ * deaths are counted in the same sweep.
+ *
+ * @param current Current generation, ghost rows filled.
+ * @param next    Slab receiving the next generation (same rows and cols);
+ *                its cell array grows as needed.
+ * @param stats   OUT: population, births, deaths and change flag of `next`.
+ * @return 0 on success, -1 if the cell array could not grow.
+ */
+int life_step_list(const life_list_t *current, life_list_t *next, life_stats_t *stats);
+
+#endif // LIFELIST_H
@@ -0,0 +1,114 @@
+//    _____      _     ___        __   _   __      __       
+//   |_   _|    (_)  .' ..]      [  | / |_[  |    [  |      
+//     | |      __  _| |_  .---.  | |`| |-'| |     | |--.   
+//     | |   _ [  |'-| |-'/ /__\\ | | | |  | |     | .-. |  
+//    _| |__/ | | |  | |  | \__., | | | |, | |  _  | | | |  
+//   |________|[___][___]  '.__.'[___]\__/[___](_)[___]|__] 
+//                                                          
+
+#ifndef LIFELTL_H
+#define LIFELTL_H
+
+#include "life.h"
+
+/**
+ * @brief Largest neighborhood radius accepted in a Larger-than-Life rule (same cap as Golly).
+ */
+#define LIFE_LTL_MAX_RADIUS 500
+
+/**
+ * @brief Larger-than-Life rule: two states, range-R Moore neighborhood.
+ *
+ * A cell counts the alive cells of the (2R+1)×(2R+1) square around it (the
+ * cell itself included iff `middle`). A dead cell becomes alive iff the count
+ * is in [birth_min, birth_max]; an alive cell stays alive iff it is in
+ * [survive_min, survive_max]. An empty range has min > max.
+ */
+typedef struct {
+    int radius;                     // R, 1..LIFE_LTL_MAX_RADIUS
+    int middle;                     // 1 if the cell counts in its own neighborhood
+    int survive_min, survive_max;   // S range
+    int birth_min, birth_max;       // B range (birth_min >= 1)
+} life_ltl_rule_t;
+
+/**
+ * @brief State of the ltl engine: the rule and the sliding window sums of a sweep.
+ *
+ * Allocated with life_ltl_create(), released with life_ltl_destroy().
+ */
+typedef struct {
+    life_ltl_rule_t rule;   // rule being run
+    int cols;               // number of columns
+    int *colsum;            // alive cells of rows i-R..i+R in every column 1..cols
+    int *prefix;            // prefix sums of colsum, R+1 leading zeros and R trailing copies of the total
+} life_ltl_t;
+
+/**
+ * @brief Compile a Larger-than-Life rulestring into a rule.
+ *
+ * Accepts Golly's notation "R<r>,C<c>,M<m>,S<a>..<b>,B<c>..<d>,N<n>", e.g.
+ * "R5,C0,M1,S34..58,B34..45,NM" (Bosco's rule). The C, M and N fields are
+ * optional; only two states (C0 or C2) and the Moore neighborhood (NM) are
+ * supported. Ranges with a birth count of 0 are rejected, as for B/S rules.
+ *
+ * @param text Rulestring (case-insensitive).
+ * @param rule OUT: compiled rule (unchanged on failure).
+ * @return 0 on success, -1 if `text` is not a valid Larger-than-Life rule.
+ */
+int life_ltl_parse_rule(const char *text, life_ltl_rule_t *rule);
+
+/**
+ * @brief Convert a B/S rule mask (see LIFE_RULE()) into a radius-1 rule.
+ *
+ * @param mask Rule mask of life_parse_rule().
+ * @param rule OUT: equivalent radius-1 rule without middle cell.
+ * @return 0 on success, -1 if the birth or survival set is not a single range
+ *         (e.g. B36/S23).
+ */
+int life_ltl_from_rule(unsigned mask, life_ltl_rule_t *rule);
+
+/**
+ * @brief Write the Golly rulestring of `rule` into `buf` (at least 64 bytes).
+ */
+void life_ltl_format_rule(const life_ltl_rule_t *rule, char *buf);
+
+/**
+ * @brief Allocate the ltl engine state for a slab of `cols` columns.
+ *
+ * @param rule Rule to run (copied).
+ * @param cols Number of columns.
+ * @return Pointer to the engine state, or NULL on failure.
+ *         Caller must free it with life_ltl_destroy().
+ */
+life_ltl_t* life_ltl_create(const life_ltl_rule_t *rule, int cols);
+
+/**
+ * @brief Destroy an engine state allocated by life_ltl_create().
+ *
+ * @param ltl Pointer returned by life_ltl_create() (may be NULL).
+ */
+void life_ltl_destroy(life_ltl_t *ltl);
+
+/**
+ * @brief Compute one generation of a Larger-than-Life rule.
+ *
+ * `current` and `next` are padded buffers of (rows+2R)*pitch bytes with R
+ * ghost rows on each side (filled by mpi_exchange_halo()); the columns beyond
+ * the board read as dead. The neighborhood count of every cell costs O(1)
+ * whatever R: the vertical sums of rows i-R..i+R are slid down one row at a
+ * time (one add and one subtract per column), and the horizontal sum over
+ * columns j-R..j+R is the difference of two prefix sums of that row of
+ * column sums (a summed-area table kept one row at a time). Only real
+ * rows/columns of `next` are written.
+ *
+ * @param ltl     Engine state of life_ltl_create() (same `cols`).
+ * @param current Pointer to current board of size (rows+2R)*pitch.
+ * @param next    Pointer to buffer for next board, same size.
+ * @param rows    Number of real rows (excludes ghost).
+ * @param pitch   Bytes per padded row (life_pitch(cols)).
+ * @param stats   OUT: population and transitions of this sweep (not NULL).
+ */
+void life_step_ltl(life_ltl_t *ltl, const char *current, char *next, int rows, int pitch,
+                   life_stats_t *stats);
+
+#endif // LIFELTL_H
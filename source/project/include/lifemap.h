@@ -0,0 +1,78 @@
+//    _____      _     ___                                      __       
+//   |_   _|    (_)  .' ..]                                    [  |      
+//     | |      __  _| |_  .---.  _ .--..--.   ,--.  _ .--.     | |--.   
+//     | |   _ [  |'-| |-'/ /__\\[ `.-. .-. | `'_\ :[ '/'`\ \   | .-. |  
+//    _| |__/ | | |  | |  | \__., | | | | | | // | |,| \__/ |_  | | | |  
+//   |________|[___][___]  '.__.'[___||__||__]\'-;__/| ;.__/(_)[___]|__] 
+//                                                  [__|                 
+
+#ifndef LIFEMAP_H
+#define LIFEMAP_H
+
+#include <stddef.h>
+#include "life.h"
+
+/**
+ * @brief Bytes of the current generation covered by one band of life_step_map() (whole rows, at least one).
+ */
+#define LIFE_MAP_BAND_BYTES (8 << 20)
+
+/**
+ * @brief Out-of-core slab: both generations live in memory-mapped files on local disk.
+ *
+ * `current` and `next` are shared mappings of two files of (rows+2)*pitch
+ * bytes, laid out exactly like life_alloc() buffers (ghost rows, ghost
+ * columns and padding included), so the byte kernels and
+ * mpi_exchange_ghosts() run on them unchanged. The files start sparse (all
+ * cells dead) and are unlinked as soon as they are mapped, so they vanish
+ * with the process. The OS pages the cells in and out; for slabs larger
+ * than memory, life_step_map() keeps only a few bands of rows mapped at a time.
+ */
+typedef struct {
+    int rows;           // real rows of the slab
+    int cols;           // number of columns
+    int pitch;          // bytes per padded row (life_pitch(cols))
+    int band;           // rows per band of life_step_map()
+    int release;        // 1 to drop the pages of finished bands (both generations exceed half the RAM)
+    size_t bytes;       // bytes of each mapping: (rows + 2) * pitch
+    char *current;      // mapped current generation
+    char *next;         // mapped next generation
+} life_map_t;
+
+/**
+ * @brief Create the two mapped generations of an out-of-core slab (all cells dead).
+ *
+ * @param rows Number of real rows (excludes ghost).
+ * @param cols Number of columns.
+ * @param dir  Directory of the backing files (a local disk), or NULL for
+ *             $TMPDIR (or /tmp if unset).
+ * @return New slab, or NULL if a file could not be created, sized or mapped.
+ */
+life_map_t *life_map_create(int rows, int cols, const char *dir);
+
+/**
+ * @brief Unmap both generations (the unlinked files are then released) and free the slab.
+ *
+ * @param map Slab returned by life_map_create(), or NULL.
+ */
+void life_map_destroy(life_map_t *map);
+
+/**
+ * @brief Advance an out-of-core slab by one generation and swap its generations.
+ *
+ * The slab is computed in bands of map->band rows with the selected
+ * life_step() kernel. While a band is computed, the rows of the next one are
+ * requested with madvise(MADV_WILLNEED), so the disk reads overlap the
+ * computation. When the slab does not fit comfortably in memory
+ * (map->release), the rows no later band needs (current) or writes (next)
+ * are then dropped with madvise(MADV_DONTNEED), the written ones staying in
+ * the file; otherwise they stay mapped, since faulting them in again would
+ * cost more than the sweep. The ghost rows of map->current must have been
+ * filled (mpi_exchange_ghosts()).
+ *
+ * @param map   Out-of-core slab; on return map->current holds the new generation.
+ * @param stats OUT: population and transitions of the whole slab (not NULL).
+ */
+void life_step_map(life_map_t *map, life_stats_t *stats);
+
+#endif // LIFEMAP_H
@@ -0,0 +1,121 @@
+//    _____      _     ___                                    _                       __       
+//   |_   _|    (_)  .' ..]                                  / |_                    [  |      
+//     | |      __  _| |_  .---.  _ .--..--.  .--.    _ .--.`| |-'.--.    _ .--.      | |--.   
+//     | |   _ [  |'-| |-'/ /__\\[ `.-. .-. |/ .'`\ \[ `/'`\]| | / .'`\ \[ `.-. |     | .-. |  
+//    _| |__/ | | |  | |  | \__., | | | | | || \__. | | |    | |,| \__. | | | | |  _  | | | |  
+//   |________|[___][___]  '.__.'[___||__||__]'.__.' [___]   \__/ '.__.' [___||__](_)[___]|__] 
+//                                                                                             
+
+#ifndef LIFEMORTON_H
+#define LIFEMORTON_H
+
+#include "life.h"
+
+/**
+ * @brief Real cells per side of a square tile of the Morton layout.
+ *
+ * A multiple of 32 so that every tile row is whole AVX2 vectors, and wide
+ * enough that the per-row overhead of the byte kernels stays small (64-cell
+ * tiles ran about twice as slow as the byte engine); a tile with its border
+ * (about 65 KiB) still fits in L2 next to the tile it is written to.
+ */
+#define LIFE_MORTON_TILE 256
+
+/**
+ * @brief Bytes per row of a tile: the cells plus the two border columns.
+ *
+ * Tiles are not padded to LIFE_ALIGN (no row of a tile is aligned anyway); the
+ * byte kernels only use unaligned loads/stores and read columns 0..cols+1,
+ * so a pitch of cols + 2 is enough.
+ */
+#define LIFE_MORTON_PITCH (LIFE_MORTON_TILE + 2)
+
+/**
+ * @brief Bytes per tile, border included.
+ */
+#define LIFE_MORTON_BYTES ((LIFE_MORTON_TILE + 2) * LIFE_MORTON_PITCH)
+
+/**
+ * @brief Local slab stored as square tiles laid out along a Z-order (Morton) curve.
+ *
+ * The slab is cut into a tiles_y × tiles_x grid of LIFE_MORTON_TILE² tiles
+ * (the last tile row/column may be partial; cells outside the board stay 0).
+ * Every tile is a small padded buffer of its own (cell (r, c) of the tile at
+ * (r+1)*LIFE_MORTON_PITCH + c+1, border rows/columns around it), and tiles
+ * are stored in the order of the Morton code of (ty, tx), so the tiles
+ * around a tile are close in memory in both dimensions instead of `pitch`
+ * bytes apart per row: wide slabs touch far fewer pages and cache lines.
+ *
+ * The border of every tile holds copies of the neighbor cells (from the
+ * adjacent tiles or the ghost rows) and is refreshed by life_step_morton()
+ * before computing, so the byte kernels run on each tile unchanged.
+ *
+ * The rows above and below the slab (filled by mpi_exchange_ghosts_morton())
+ * are kept as plain padded rows: ghost[g][1 + j] is column j, ghost[g][0] and
+ * ghost[g][cols + 1] are dead.
+ */
+typedef struct {
+    int rows;           // real rows of the slab
+    int cols;           // number of columns
+    int tiles_y;        // tile rows, ceil(rows / LIFE_MORTON_TILE)
+    int tiles_x;        // tile columns, ceil(cols / LIFE_MORTON_TILE)
+    int *slot;          // tiles_y*tiles_x: storage slot of tile (ty, tx), row-major
+    int *order;         // tiles_y*tiles_x: tile (ty*tiles_x + tx) stored in each slot
+    char *cells;        // tiles_y*tiles_x tiles of LIFE_MORTON_BYTES, slot s at s*LIFE_MORTON_BYTES
+    char *ghost[2];     // padded rows above (0) and below (1) the slab, cols + 2 bytes each
+    char *edge[2];      // send buffers: first (0) and last (1) real row, cols bytes each
+} life_morton_t;
+
+/**
+ * @brief Build a Morton slab from the real rows of a padded byte buffer.
+ *
+ * @param buf   Padded buffer (rows+2)*pitch laid out as by life_alloc(),
+ *              or NULL for an all-dead slab.
+ * @param rows  Number of real rows.
+ * @param cols  Number of columns.
+ * @param pitch Bytes per padded row (life_pitch(cols)).
+ * @return Pointer to the slab, or NULL on failure.
+ *         Caller must free it with life_morton_destroy().
+ */
+life_morton_t* life_morton_create(const char *buf, int rows, int cols, int pitch);
+
+/**
+ * @brief Destroy a slab allocated by life_morton_create().
+ *
+ * @param morton Pointer returned by life_morton_create() (may be NULL).
+ */
+void life_morton_destroy(life_morton_t *morton);
+
+/**
+ * @brief Pack the first and last real rows into morton->edge for the ghost exchange.
+ *
+ * @param morton Slab whose boundary rows are copied (cols bytes each).
+ */
+void life_morton_pack_edges(life_morton_t *morton);
+
+/**
+ * @brief Count alive cells of a Morton slab (ghost rows excluded).
+ *
+ * Only the real cells of every tile are counted (borders hold copies).
+ *
+ * @param morton Slab to count.
+ * @return Number of alive cells.
+ */
+long life_morton_count(const life_morton_t *morton);
+
+/**
+ * @brief Compute one generation of a Morton slab, one tile at a time.
+ *
+ * First the borders of every tile of `current` are refreshed from the
+ * adjacent tiles and the ghost rows (O(perimeter) per tile); then tiles are
+ * visited in storage (Z) order and the selected life_step() kernel advances
+ * each one straight into the same slot of `next`.
+ *
+ * @param current Slab holding the current generation, ghost rows filled
+ *                (only the tile borders are modified).
+ * @param next    Slab created with the same rows/cols; receives the next generation.
+ * @param stats   OUT: population and transitions of this sweep.
+ */
+void life_step_morton(life_morton_t *current, life_morton_t *next, life_stats_t *stats);
+
+#endif // LIFEMORTON_H
@@ -0,0 +1,153 @@
+//    _____      _     ___        _    _   __            __       
+//   |_   _|    (_)  .' ..]      / |_ (_) [  |          [  |      
+//     | |      __  _| |_  .---.`| |-'__   | | .---.     | |--.   
+//     | |   _ [  |'-| |-'/ /__\\| | [  |  | |/ /__\\    | .-. |  
+//    _| |__/ | | |  | |  | \__.,| |, | |  | || \__., _  | | | |  
+//   |________|[___][___]  '.__.'\__/[___][___]'.__.'(_)[___]|__] 
+//                                                                
+
+#ifndef LIFETILE_H
+#define LIFETILE_H
+
+#include "life.h"
+
+/**
+ * @brief Default tile of the temporal-blocking engine (real cells, excluding the halo).
+ *
+ * Two scratch tiles of (LIFE_TILE_ROWS + 2T) × life_pitch(LIFE_TILE_COLS + 2T)
+ * bytes stay well inside a 256 KiB L2 for the usual depths (T ≤ 16).
+ */
+#define LIFE_TILE_ROWS 64
+#define LIFE_TILE_COLS 1024
+
+/**
+ * @brief Advance a padded buffer by `gens` generations, one cache-sized tile at a time.
+ *
+ * Temporal blocking with overlapped (trapezoid) tiles: the slab is cut into
+ * tiles of tile_rows × tile_cols output cells. Each tile is copied into a
+ * scratch buffer together with `gens` extra rows/columns on every side (only
+ * columns inside the board; outside columns are dead ghost columns) and is
+ * advanced `gens` times with life_step() while ping-ponging between two
+ * scratch buffers that stay in cache. The computed region shrinks by one
+ * cell per generation on every side that does not touch the board edge, so
+ * after the last generation exactly the tile is valid and is copied to `next`.
+ *
+ * The slab is read and written once per `gens` generations instead of once
+ * per generation; the price is recomputing the overlap between tiles. The
+ * intermediate generations are never stored, so their populations are
+ * counted on the tile while it is in cache (gen_alive).
+ *
+ * `current` needs `gens` ghost rows above and below the slab (see
+ * mpi_exchange_halo()): the buffer has rows + 2*gens padded rows of `pitch`
+ * bytes and the real rows are gens..gens+rows-1. Only real rows/columns of
+ * `next` are set.
+ *
+ * @param current   Pointer to current board of size (rows+2*gens)*pitch.
+ * @param next      Pointer to buffer for the board `gens` generations later, same size.
+ * @param rows      Number of real rows (excludes the ghost rows).
+ * @param cols      Number of columns.
+ * @param pitch     Bytes per padded row (life_pitch(cols)).
+ * @param gens      Generations to advance (>= 1, depth of the halo).
+ * @param tile_rows Output rows per tile (> 0).
+ * @param tile_cols Output columns per tile (> 0).
+ * @param stats     OUT: population and transitions of the last generation.
+ * @param gen_alive OUT: alive cells after each generation (`gens` entries,
+ *                  gen_alive[g-1] after generation g), or NULL.
+ * @return 0 on success, -1 if the scratch tiles cannot be allocated.
+ */
+int life_step_tiled(const char *current, char *next, int rows, int cols, int pitch,
+                    int gens, int tile_rows, int tile_cols, life_stats_t *stats,
+                    long *gen_alive);
+
+/**
+ * @brief Default tile of the active-tile engine (real cells per tile).
+ *
+ * Small enough that settled regions are skipped at a fine grain, wide enough
+ * that a tile row is still a few full SIMD vectors.
+ */
+#define LIFE_ACTIVE_ROWS 32
+#define LIFE_ACTIVE_COLS 128
+
+/**
+ * @brief Per-tile change flags kept by life_step_active().
+ */
+enum {
+    LIFE_TILE_CHANGED1 = 1,     // tile differs from the generation before (g vs g-1)
+    LIFE_TILE_CHANGED2 = 2      // tile differs from two generations before (g vs g-2)
+};
+
+/**
+ * @brief Change tracking of a slab cut into tiles (see life_step_active()).
+ *
+ * One entry per tile, row-major over a tiles_y × tiles_x grid. Allocated with
+ * life_tiles_create(), released with life_tiles_destroy().
+ */
+typedef struct {
+    int rows, cols;             // slab size (real cells)
+    int tile_rows, tile_cols;   // cells per tile (edge tiles may be smaller)
+    int tiles_y, tiles_x;       // tile grid
+    int steps;                  // steps taken so far (history is partial for the first two)
+    unsigned char *changed;     // LIFE_TILE_CHANGED* flags of the last generation
+    unsigned char *dirty;       // tile must be recomputed in this generation
+    long *alive;                // alive cells of every tile in the last generation
+    long *alive_prev;           // alive cells of every tile in the generation before
+    long *births, *deaths;      // transitions of every tile in the last generation
+    char *ghost;                // ghost rows 0 and rows+1 of the last two steps (4 × cols)
+    unsigned char *border;      // LIFE_TILE_CHANGED* flags of the ghost rows over each tile column
+    long computed;              // tiles recomputed by the last step
+    long frozen;                // period-2 tiles flipped without computing by the last step
+} life_tiles_t;
+
+/**
+ * @brief Allocate the change tracking of a rows × cols slab.
+ *
+ * @param rows      Number of real rows of the slab.
+ * @param cols      Number of columns.
+ * @param tile_rows Rows per tile (> 0).
+ * @param tile_cols Columns per tile (> 0).
+ * @return Pointer to the tracking state, or NULL on failure.
+ *         Caller must free it with life_tiles_destroy().
+ */
+life_tiles_t* life_tiles_create(int rows, int cols, int tile_rows, int tile_cols);
+
+/**
+ * @brief Destroy tracking state allocated by life_tiles_create().
+ *
+ * @param tiles Pointer returned by life_tiles_create() (may be NULL).
+ */
+void life_tiles_destroy(life_tiles_t *tiles);
+
+/**
+ * @brief Compute one generation, skipping tiles that are static or period-2.
+ *
+ * Same buffer contract as life_step(), plus a third buffer `spare` of the
+ * same size. `current` (generation g) and `next` must be the same two buffers
+ * swapped after every step, so `next` still holds generation g-1 on entry.
+ *
+ * A tile is skipped when, over its 3×3 tile neighborhood (and, for the first
+ * and last tile row, the ghost row exchanged over it):
+ *
+ *   - nothing changed between g-1 and g: the tile stays as it is, which is
+ *     what `next` already holds (g-1 == g);
+ *   - nothing changed between g-2 and g (blinkers and other period-2 ash):
+ *     the tile is frozen, generation g+1 equals g-1, which `next` already
+ *     holds, so the tile just flips between the two buffers.
+ *
+ * Any other tile is recomputed with life_step() into `spare` and compared
+ * with generation g-1 in `next`; it is copied to `next` only if it differs,
+ * which is how period-2 tiles are detected. The first step computes every tile.
+ *
+ * Population, births and deaths of skipped tiles follow from the per-tile
+ * counts of the last two steps, so `stats` covers the whole slab.
+ *
+ * @param tiles   Tracking state of this slab (from life_tiles_create()).
+ * @param current Pointer to current board of size (rows+2)*pitch.
+ * @param next    Pointer to buffer for next board (holding generation g-1), same size.
+ * @param spare   Pointer to a scratch board of the same size.
+ * @param pitch   Bytes per padded row (life_pitch(cols)).
+ * @param stats   OUT: population and transitions of this sweep (not NULL).
+ */
+void life_step_active(life_tiles_t *tiles, const char *current, char *next, char *spare,
+                      int pitch, life_stats_t *stats);
+
+#endif // LIFETILE_H
@@ -10,41 +10,103 @@
 #define MPIX_H
 
 #include <mpi.h>
+#include <stdint.h>
+
+#include "life.h"
+#include "lifelist.h"
+#include "lifedelta.h"
+#include "lifelenia.h"
+#include "lifemap.h"
+#include "lifemorton.h"
 
 /**
- * @brief Exchange ghost rows with neighbor ranks (row-based, cyclic).
+ * @brief Create the line of ranks along which the slabs exchange their ghost rows.
+ *
+ * A one-dimensional Cartesian communicator over all the ranks of `comm`, in
+ * the same order. Periodic (a ring), the first and last ranks are neighbors,
+ * as on any plain communicator; otherwise MPI_Cart_shift() gives
+ * MPI_PROC_NULL past the edges, so the edge ranks skip that half of every
+ * ghost exchange below and their outer ghost rows are left untouched.
+ *
+ * @param periodic Non-zero if the rows of the board wrap around.
+ * @param comm     MPI communicator (e.g., MPI_COMM_WORLD).
+ * @return New communicator; release it with MPI_Comm_free().
+ */
+MPI_Comm mpi_create_line(int periodic, MPI_Comm comm);
+
+/**
+ * @brief Exchange ghost rows with neighbor ranks along the line communicator (row-based).
+ *
+ * Given a padded buffer buf of size (local_rows+2)*pitch (see life_pitch()):
+ *   - buf[0..pitch-1] is the top ghost row.
+ *   - buf[pitch..(local_rows+1)*pitch-1] are the real rows.
+ *   - buf[(local_rows+1)*pitch..end] is the bottom ghost row.
+ * Inside each row the cols real cells start at offset 1; only those cells
+ * are transferred, ghost columns and padding are left untouched.
  *
- * Given a padded buffer buf of size (local_rows+2)*cols:
- *   - buf[0..cols-1] is the top ghost row.
- *   - buf[cols..local_rows*cols+cols-1] are the real rows.
- *   - buf[(local_rows+1)*cols..end] is the bottom ghost row.
+ * rank_prev and rank_next are the neighbors along the line communicator from
+ * mpi_create_line(): periodic only for cylinder/torus, MPI_PROC_NULL past a
+ * non-periodic edge (dead/reflect), where that half of the exchange is
+ * skipped and the ghost row is left as it was. The same holds for every
+ * exchange below.
  *
  * This function:
  *   1. Sends first real row to rank_prev, receives bottom ghost from rank_next.
  *   2. Sends last real row to rank_next, receives top ghost from rank_prev.
  *
- * @param buf         Padded buffer ((local_rows+2)*cols).
+ * @param buf         Padded buffer ((local_rows+2)*pitch).
  * @param local_rows  Number of real rows (excluding ghosts).
  * @param cols        Number of columns.
+ * @param pitch       Bytes per padded row.
  * @param comm        MPI communicator.
  */
 void mpi_exchange_ghosts(char *buf,
                          int local_rows,
                          int cols,
+                         int pitch,
                          MPI_Comm comm);
 
 
+/**
+ * @brief Exchange `halo` ghost rows on each side with neighbor ranks along the line communicator.
+ *
+ * Deep-halo counterpart of mpi_exchange_ghosts() for kernels that advance
+ * several generations per exchange. buf has local_rows+2*halo padded rows of
+ * `pitch` bytes: rows 0..halo-1 are the top ghost rows, the real rows are
+ * halo..halo+local_rows-1, the remaining halo rows are the bottom ghost rows.
+ * Only the cols real cells of each row are transferred. Requires
+ * local_rows >= halo on every rank (ghost rows come from direct neighbors).
+ *
+ * @param buf         Padded buffer ((local_rows+2*halo)*pitch).
+ * @param local_rows  Number of real rows (excluding ghosts).
+ * @param cols        Number of columns.
+ * @param pitch       Bytes per padded row.
+ * @param halo        Ghost rows on each side.
+ * @param comm        MPI communicator.
+ */
+void mpi_exchange_halo(char *buf,
+                       int local_rows,
+                       int cols,
+                       int pitch,
+                       int halo,
+                       MPI_Comm comm);
+
 /**
  * @brief Distribute rows of the board from MASTER to all ranks (row-based).
  *
  * On MASTER (rank 0), full_board points to a plain array of size rows*cols.
  * Other ranks pass full_board = NULL. Each rank receives local_rows rows into
- * a padded buffer of size (local_rows+2)*cols, with two ghost rows to be filled
- * by mpi_exchange_ghosts().
+ * a zeroed, cache-line aligned padded buffer of size (local_rows+2*halo)*pitch,
+ * with `halo` ghost rows on each side to be filled by mpi_exchange_ghosts()
+ * or mpi_exchange_halo() and two ghost columns per row (same layout as
+ * life_alloc() for halo = 1). The rows land straight in their final place, so
+ * the buffer can be used as the current generation without another copy.
  *
  * @param full_board   On MASTER: pointer to plain board (rows*cols). Others: NULL.
  * @param rows         Total number of rows in full_board.
  * @param cols         Total number of columns.
+ * @param pitch        Bytes per padded row (life_pitch(cols)).
+ * @param halo         Ghost rows on each side of the slab (>= 1).
  * @param local        OUT: pointer to newly allocated padded buffer.
  * @param local_rows   OUT: number of real rows assigned to this rank.
  * @param comm         MPI communicator (e.g., MPI_COMM_WORLD).
@@ -52,10 +114,39 @@ void mpi_exchange_ghosts(char *buf,
 void mpi_scatter_board(char *full_board,
                        int rows,
                        int cols,
+                       int pitch,
+                       int halo,
                        char **local,
                        int *local_rows,
                        MPI_Comm comm);
 
+/**
+ * @brief Draw the random board straight into the padded slab of every rank (no scatter).
+ *
+ * Counterpart of mpi_scatter_board() for a random board: every rank allocates
+ * the same padded buffer for the same rows and draws only its own rows with
+ * life_random(), so no rank ever holds the whole board and the cells are the
+ * same for any number of ranks (and the same as life_create()). As in
+ * life_create(), an all-dead board is drawn again with the next attempt.
+ *
+ * @param rows         Total number of rows of the board.
+ * @param cols         Total number of columns.
+ * @param halo         Ghost rows on each side of the slab (>= 1).
+ * @param seed         Seed of the board (the same on every rank).
+ * @param density      Probability that a cell is alive, in (0, 1].
+ * @param local        OUT: pointer to newly allocated padded buffer (life_alloc() layout).
+ * @param local_rows   OUT: number of real rows assigned to this rank.
+ * @param comm         MPI communicator.
+ */
+void mpi_random_board(int rows,
+                      int cols,
+                      int halo,
+                      unsigned int seed,
+                      double density,
+                      char **local,
+                      int *local_rows,
+                      MPI_Comm comm);
+
 /**
  * @brief Gather global alive-cell count via MPI_Reduce.
  *
@@ -68,43 +159,302 @@ void mpi_scatter_board(char *full_board,
  */
 long mpi_reduce_count(long local_count, MPI_Comm comm);
 
+/**
+ * @brief Sum a per-rank count on every rank via MPI_Allreduce.
+ *
+ * All-ranks counterpart of mpi_reduce_count(), for decisions that every
+ * rank must take together (e.g. whether any rank ran out of memory, or
+ * whether any message is still in flight).
+ *
+ * @param local_count Count contributed by this rank.
+ * @param comm        MPI communicator.
+ * @return Sum of all local counts, on every rank.
+ */
+long mpi_allreduce_count(long local_count, MPI_Comm comm);
 
 /**
- * @brief Check if the board has reached a steady state (no cell changed).
+ * @brief Sum `n` per-rank counts element-wise on every rank via MPI_Allreduce.
  *
- * Each rank compares its “real” rows in current[] vs next[]. If any difference
- * is found, local_changed=1; then an MPI_Allreduce(MPI_LOR) across all ranks
- * yields global_changed. If global_changed==0, the board is stable.
+ * Array counterpart of mpi_allreduce_count(), e.g. for the population of
+ * every generation of a multi-generation step.
  *
- * @param current     Padded buffer holding current generation ((local_rows+2)*cols).
- * @param next        Padded buffer holding next generation ((local_rows+2)*cols).
- * @param local_rows  Number of real rows per rank.
- * @param cols        Number of columns.
+ * @param local  Counts contributed by this rank (n entries).
+ * @param global OUT: element-wise sums over all ranks (n entries).
+ * @param n      Number of counts.
+ * @param comm   MPI communicator.
+ */
+void mpi_allreduce_counts(const long *local, long *global, int n, MPI_Comm comm);
+
+/**
+ * @brief Personalized all-to-all exchange of uint64_t batches (one BSP superstep).
+ *
+ * send holds the batches for rank 0, 1, ... back to back, send_counts[r]
+ * words for rank r (possibly 0). The counts are exchanged first with
+ * MPI_Alltoall, then the batches with MPI_Alltoallv into *recv, which is
+ * grown with realloc() as needed (*recv_capacity words). On return the
+ * batch from rank r is the recv_counts[r] words following those of ranks
+ * 0..r-1.
+ *
+ * The displacements of MPI_Alltoallv are int, so a rank sending or receiving
+ * more than INT_MAX words in one superstep aborts with an error instead of
+ * letting them wrap.
+ *
+ * @param send           Outgoing batches, grouped by destination rank.
+ * @param send_counts    Words for every rank (size of comm entries).
+ * @param recv           IN/OUT: receive buffer (may be NULL initially).
+ * @param recv_counts    OUT: words received from every rank.
+ * @param recv_capacity  IN/OUT: capacity of *recv in words.
+ * @param comm           MPI communicator.
+ * @return Total number of words received.
+ */
+long mpi_exchange_batches(const uint64_t *send,
+                          const int *send_counts,
+                          uint64_t **recv,
+                          int *recv_counts,
+                          long *recv_capacity,
+                          MPI_Comm comm);
+
+/**
+ * @brief Combine the per-rank statistics of a fused step on every rank.
+ *
+ * A single MPI_Allreduce(MPI_SUM) of alive, births, deaths and changed, so
+ * every rank receives the global population and knows whether any cell on
+ * any rank changed. This replaces re-scanning the slab for the steady-state
+ * and zero-population checks:
+ *   - global->changed == 0  → the board is stable.
+ *   - global->alive   == 0  → the global population is zero.
+ *
+ * @param local   Statistics returned by this rank's step kernel.
+ * @param global  OUT: statistics summed over all ranks (changed is 0 or 1).
+ * @param comm    MPI communicator.
+ */
+void mpi_reduce_stats(const life_stats_t *local,
+                      life_stats_t *global,
+                      MPI_Comm comm);
+
+
+/**
+ * @brief Combine the per-lane statistics of an ensemble step on every rank.
+ *
+ * Ensemble counterpart of mpi_reduce_stats(): a single MPI_Allreduce(MPI_SUM)
+ * of the 64 populations and of the 64 change bits (as 0/1 counters), so
+ * every rank takes the same early-exit decision for every lane.
+ *
+ * @param local   Per-lane statistics returned by this rank's life_step_ensemble().
+ * @param global  OUT: populations summed over all ranks, lanes changed on any rank.
+ * @param comm    MPI communicator.
+ */
+void mpi_reduce_lanes(const life_lanes_t *local,
+                      life_lanes_t *global,
+                      MPI_Comm comm);
+
+/**
+ * @brief Exchange packed ghost rows with neighbor ranks along the line communicator (row-based).
+ *
+ * Packed counterpart of mpi_exchange_ghosts(): buf holds (local_rows+2) rows
+ * of `stride` words each (see life_step_packed()), so every ghost row costs
+ * stride*8 bytes instead of cols bytes.
+ *
+ * @param buf         Padded packed buffer ((local_rows+2)*stride words).
+ * @param local_rows  Number of real rows (excluding ghosts).
+ * @param stride      Words per padded row (life_packed_words(cols) + 2).
  * @param comm        MPI communicator.
- * @return 1 if stable (no changes), 0 otherwise.
  */
-int mpi_check_steady_state(const char *current,
-                           const char *next,
-                           int local_rows,
+void mpi_exchange_ghosts_packed(uint64_t *buf,
+                                int local_rows,
+                                int stride,
+                                MPI_Comm comm);
+
+/**
+ * @brief Exchange the ghost rows of a sparse slab with neighbor ranks along the line communicator (row-based).
+ *
+ * Sparse counterpart of mpi_exchange_ghosts(): only the alive columns of
+ * the first and last real rows travel (one message per direction whose
+ * length is the population of the row, read back with MPI_Get_count()),
+ * and land in list->ghost[1] and list->ghost[0] of the neighbors.
+ *
+ * @param list  Sparse slab (see life_list_t).
+ * @param comm  MPI communicator.
+ */
+void mpi_exchange_ghosts_list(life_list_t *list, MPI_Comm comm);
+
+/**
+ * @brief Exchange the flips of the boundary rows of a delta slab with neighbor ranks along the line communicator.
+ *
+ * Event-driven counterpart of mpi_exchange_ghosts(): the neighbors already
+ * hold the previous state of our boundary rows, so only the columns that
+ * flipped in the last generation travel (read back with MPI_Get_count()),
+ * and land in delta->ghost_flips[1] and delta->ghost_flips[0] of the neighbors.
+ *
+ * @param delta Event-driven slab (see life_delta_t).
+ * @param comm  MPI communicator.
+ */
+void mpi_exchange_ghosts_delta(life_delta_t *delta, MPI_Comm comm);
+
+/**
+ * @brief Exchange the ghost rows of a Morton slab with neighbor ranks along the line communicator (row-based).
+ *
+ * The boundary rows are spread over a row of tiles, so they are first packed
+ * into morton->edge (life_morton_pack_edges()) and then travel as in
+ * mpi_exchange_ghosts(), landing in morton->ghost[1] and morton->ghost[0]
+ * (after the dead ghost column) of the neighbors.
+ *
+ * @param morton Morton slab (see life_morton_t).
+ * @param comm   MPI communicator.
+ */
+void mpi_exchange_ghosts_morton(life_morton_t *morton, MPI_Comm comm);
+
+/**
+ * @brief Exchange the R ghost rows of a Lenia slab with neighbor ranks along the line communicator (row-based).
+ *
+ * Float counterpart of mpi_exchange_halo(): the slab has no ghost columns,
+ * so the first and last R real rows are contiguous and travel as
+ * R*cols floats each, landing in the bottom and top ghost rows of the
+ * neighbors. Requires lenia->rows >= R on every rank.
+ *
+ * @param lenia Lenia slab (see life_lenia_t).
+ * @param comm  MPI communicator.
+ */
+void mpi_exchange_ghosts_lenia(life_lenia_t *lenia, MPI_Comm comm);
+
+/**
+ * @brief Distribute rows of a packed board from MASTER to all ranks (row-based).
+ *
+ * On MASTER, full_board points to a plain packed array of rows*words words
+ * (as returned by life_pack()). Each rank receives local_rows rows
+ * into a zero-initialized padded buffer of (local_rows+2)*(words+2) words:
+ * one ghost row above and below, one ghost word left and right of each row.
+ *
+ * @param full_board   On MASTER: pointer to plain packed board. Others: NULL.
+ * @param rows         Total number of rows in full_board.
+ * @param words        Words per plain row (life_packed_words(cols), or cols for an ensemble).
+ * @param local        OUT: pointer to newly allocated padded packed buffer.
+ * @param local_rows   OUT: number of real rows assigned to this rank.
+ * @param comm         MPI communicator (e.g., MPI_COMM_WORLD).
+ */
+void mpi_scatter_board_packed(uint64_t *full_board,
+                              int rows,
+                              int words,
+                              uint64_t **local,
+                              int *local_rows,
+                              MPI_Comm comm);
+
+/**
+ * @brief Draw the random board straight into the packed slab of every rank.
+ *
+ * Packed counterpart of mpi_random_board(), with the buffer of
+ * mpi_scatter_board_packed(): the cells are those of the byte board.
+ *
+ * @param rows         Total number of rows of the board.
+ * @param cols         Total number of columns.
+ * @param seed         Seed of the board (the same on every rank).
+ * @param density      Probability that a cell is alive, in (0, 1].
+ * @param local        OUT: pointer to newly allocated padded packed buffer.
+ * @param local_rows   OUT: number of real rows assigned to this rank.
+ * @param comm         MPI communicator.
+ */
+void mpi_random_board_packed(int rows,
+                             int cols,
+                             unsigned int seed,
+                             double density,
+                             uint64_t **local,
+                             int *local_rows,
+                             MPI_Comm comm);
+
+/**
+ * @brief Draw the LIFE_LANES random boards of an ensemble straight into the slab of every rank.
+ *
+ * Lane k is the board mpi_random_board() draws with seed + k, attempts
+ * included (a lane is drawn again only while it is all dead), in the buffer
+ * of mpi_scatter_board_packed() with one word per cell.
+ *
+ * @param rows         Total number of rows of every board.
+ * @param cols         Total number of columns.
+ * @param seed         Seed of lane 0 (the same on every rank).
+ * @param density      Probability that a cell is alive, in (0, 1].
+ * @param local        OUT: pointer to newly allocated padded buffer of (local_rows+2)*(cols+2) words.
+ * @param local_rows   OUT: number of real rows assigned to this rank.
+ * @param comm         MPI communicator.
+ */
+void mpi_random_board_ensemble(int rows,
+                               int cols,
+                               unsigned int seed,
+                               double density,
+                               uint64_t **local,
+                               int *local_rows,
+                               MPI_Comm comm);
+
+/**
+ * @brief Fill out-of-core slabs with the board: drawn in place, or streamed from MASTER.
+ *
+ * Out-of-core counterpart of mpi_scatter_board() and mpi_random_board():
+ * every rank maps its slab with life_map_create() (rows split as in
+ * mpi_scatter_board()). A random board is drawn by every rank straight into
+ * its mapped current generation, with the cells of mpi_random_board(); a
+ * pattern is sent by MASTER one band (map->band rows) at a time. No rank
+ * ever holds the board in memory, so it may exceed the memory of the nodes.
+ *
+ * @param pattern  On MASTER: board loaded with life_load() (rows*cols), or NULL for
+ *                 a random board. Others: ignored.
+ * @param rows     Total number of rows of the board.
+ * @param cols     Total number of columns.
+ * @param seed     Seed of the random board (see life_random()).
+ * @param density  Probability that a cell of the random board is alive.
+ * @param dir      Directory of the backing files (see life_map_create()).
+ * @param map      OUT: out-of-core slab of this rank.
+ * @param comm     MPI communicator.
+ */
+void mpi_scatter_board_map(const char *pattern,
+                           int rows,
                            int cols,
+                           unsigned int seed,
+                           double density,
+                           const char *dir,
+                           life_map_t **map,
                            MPI_Comm comm);
 
 /**
- * @brief Check if the global population is zero.
+ * @brief Bounding box of the alive cells of the whole window (grow engine).
  *
- * Each rank counts its own alive cells (in current[1..local_rows] rows),
- * sets local_zero=1 if count==0, then MPI_Allreduce(MPI_LAND) yields
- * global_zero == 1 iff every rank has zero alive cells.
+ * Every rank scans its slab with life_bounds(), shifts the box by the plane
+ * coordinates of its first row and the four extremes are combined with a
+ * single MPI_Allreduce(MPI_MIN) (bottom and right negated), so every rank
+ * receives the same box.
  *
- * @param current     Padded buffer holding current generation ((local_rows+2)*cols).
- * @param local_rows  Number of real rows per rank.
- * @param cols        Number of columns.
+ * @param buf         Padded slab of this rank ((local_rows+2)*life_pitch(window->cols)).
+ * @param local_rows  Number of real rows of this rank.
+ * @param window      Window held by all ranks (rows split as in mpi_scatter_board()).
+ * @param box         OUT: top row, left column, bottom row and right column of
+ *                    the alive cells, in plane coordinates; box[0] > box[2] if
+ *                    every cell is dead.
  * @param comm        MPI communicator.
- * @return 1 if global population is zero, 0 otherwise.
  */
-int mpi_check_zero_population(const char *current,
-                              int local_rows,
-                              int cols,
-                              MPI_Comm comm);
+void mpi_window_bounds(const char *buf,
+                       int local_rows,
+                       const life_window_t *window,
+                       long box[4],
+                       MPI_Comm comm);
+
+/**
+ * @brief Move the slabs of all ranks from one window of the plane to another (grow engine).
+ *
+ * The rows of `to` are split across the ranks as in mpi_scatter_board(), and
+ * every rank sends the part of its rows that falls in the new slab of each
+ * rank in a single MPI_Alltoallv, cut or extended to the new columns; the
+ * rows land straight in the new padded buffer (life_alloc() layout). Cells of
+ * `to` outside `from` start dead and cells of `from` outside `to` are dropped,
+ * so `to` must contain every alive cell. The old buffer is freed.
+ *
+ * @param buf         IN/OUT: padded slab of this rank, replaced by the new one.
+ * @param local_rows  IN/OUT: number of real rows of this rank.
+ * @param from        Window currently held by all ranks.
+ * @param to          Window to move to (to->rows >= number of ranks).
+ * @param comm        MPI communicator.
+ */
+void mpi_regrid_board(char **buf,
+                      int *local_rows,
+                      const life_window_t *from,
+                      const life_window_t *to,
+                      MPI_Comm comm);
 
 #endif // MPIX_H
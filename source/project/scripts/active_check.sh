@@ -0,0 +1,90 @@
+#!/bin/bash
+
+#===============================================================================
+# Active Engine Regression Check
+#
+# 1. Build small patterns that random soups do not produce, placed across the
+#    edges the active engine skips tiles on
+# 2. Run each pattern with the byte engine and with the active engine, on 1
+#    and on 2 ranks
+# 3. Compare the alive cells of every generation; any difference is a tile
+#    that was skipped (or frozen) while one of its inputs changed
+#
+# Usage: scripts/active_check.sh [path/to/game_of_life]
+#        (extra mpirun flags, e.g. --oversubscribe, go in $MPIRUN)
+#===============================================================================
+
+set -euo pipefail
+
+#--------------------------------------
+# Parameter definitions
+#--------------------------------------
+BINARY="${1:-./game_of_life}"
+MPIRUN="${MPIRUN:-mpirun}"
+PROCS=(1 2)
+EPOCHS=16
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+#--------------------------------------
+# Pattern builder: <file> <rows> <cols> <row,col>...
+#--------------------------------------
+make_pattern() {
+  local file=$1 rows=$2 cols=$3
+  shift 3
+  awk -v rows="$rows" -v cols="$cols" -v cells="$*" 'BEGIN {
+    n = split(cells, list, " ")
+    for (k = 1; k <= n; k++) { split(list[k], rc, ","); alive[rc[1], rc[2]] = 1 }
+    for (i = 0; i < rows; i++) {
+      line = ""
+      for (j = 0; j < cols; j++) line = line (((i, j) in alive) ? "O" : ".")
+      print line
+    }
+  }' > "$file"
+}
+
+#--------------------------------------
+# Test patterns
+#--------------------------------------
+# Blinker over the edge of tile columns 0 and 1 (cols 126-128), block just
+# below it in tile column 1: on 2 ranks the blinker flips the ghost row of
+# rank 1 over segment 0 only, while the block in tile column 1 reads it
+make_pattern "$WORKDIR/edge_rank.cells" 20 256 \
+  8,126 8,127 8,128  11,128 11,129 12,128 12,129
+
+# Same on one rank through the cylinder wrap: blinker on the last row, block
+# on the first ones
+make_pattern "$WORKDIR/edge_wrap.cells" 80 256 \
+  78,126 78,127 78,128  1,128 1,129 2,128 2,129
+
+# Glider heading for the ghost row of rank 1 over segment 0, next to a
+# blinker in tile column 1: on 2 ranks the blinker's tile is frozen as
+# period-2 when the glider first reaches column 127 of the ghost row
+make_pattern "$WORKDIR/edge_frozen.cells" 20 256 \
+  4,124 5,125 6,123 6,124 6,125  10,129 11,129 12,129
+
+#--------------------------------------
+# Run and compare
+#--------------------------------------
+alive_counts() {
+  $MPIRUN -np "$1" "$BINARY" -f "$2" -e "$EPOCHS" -x "$3" 2>&1 \
+    | sed -nE 's/.*Alive cells = ([0-9]+).*/\1/p' | tr '\n' ' ' || true
+}
+
+failures=0
+for pattern in "$WORKDIR"/*.cells; do
+  for np in "${PROCS[@]}"; do
+    expected=$(alive_counts "$np" "$pattern" byte)
+    actual=$(alive_counts "$np" "$pattern" active)
+    name=$(basename "$pattern" .cells)
+    if [ -n "$expected" ] && [ "$expected" = "$actual" ]; then
+      echo "ok    $name np=$np: $actual"
+    else
+      echo "FAIL  $name np=$np: byte [$expected] active [$actual]"
+      failures=$((failures + 1))
+    fi
+  done
+done
+
+exit $((failures > 0))
@@ -0,0 +1,59 @@
+#!/bin/bash
+
+#===============================================================================
+# Grow Engine Regression Check
+#
+# 1. Write a glider, the smallest pattern that keeps its alive count while it
+#    leaves the window it started in
+# 2. Run it with the grow engine for EPOCHS generations, on 1 and on 3 ranks
+# 3. Check that the run was not cut short by the alive-count exit, that the
+#    glider still has 5 cells at the last generation and that the window
+#    followed it across the plane (EPOCHS/4 cells down and right)
+#
+# Usage: scripts/grow_check.sh [path/to/game_of_life]
+#        (extra mpirun flags, e.g. --oversubscribe, go in $MPIRUN)
+#===============================================================================
+
+set -euo pipefail
+
+#--------------------------------------
+# Parameter definitions
+#--------------------------------------
+BINARY="${1:-./game_of_life}"
+MPIRUN="${MPIRUN:-mpirun}"
+PROCS=(1 3)
+EPOCHS=200
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+#--------------------------------------
+# Test pattern: glider heading down-right
+#--------------------------------------
+cat > "$WORKDIR/glider.rle" <<'EOF'
+x = 3, y = 3, rule = B3/S23
+bo$2bo$3o!
+EOF
+
+#--------------------------------------
+# Run and check
+#--------------------------------------
+failures=0
+for np in "${PROCS[@]}"; do
+  output=$($MPIRUN -np "$np" "$BINARY" -f "$WORKDIR/glider.rle" -e "$EPOCHS" -x grow 2>&1 || true)
+  last=$(echo "$output" | sed -nE 's/^\[Gen +([0-9]+)\] Alive cells = ([0-9]+).*/\1 \2/p' | tail -n 1)
+  window=$(echo "$output" | sed -nE 's/^Window: .* at \((-?[0-9]+), (-?[0-9]+)\).*/\1 \2/p')
+
+  read -r gen alive <<< "${last:-0 0}"
+  read -r row col <<< "${window:-0 0}"
+  # The window keeps a margin around the glider, so only require it to have moved most of the way
+  if [ "$gen" -eq "$EPOCHS" ] && [ "$alive" -eq 5 ] &&
+     [ "$row" -ge $((EPOCHS / 8)) ] && [ "$col" -ge $((EPOCHS / 8)) ]; then
+    echo "ok    glider np=$np: gen $gen, $alive cells, window at ($row, $col)"
+  else
+    echo "FAIL  glider np=$np: gen $gen, $alive cells, window at ($row, $col)"
+    failures=$((failures + 1))
+  fi
+done
+
+exit $((failures > 0))
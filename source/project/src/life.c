@@ -7,35 +7,184 @@
 //                                          
 
 #include <time.h>
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "life.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#define LIFE_X86 1
+#include <immintrin.h>
+#endif
+
 /* ********************************************************************************************* */
 
-char* life_create(int rows, int cols, unsigned int seed) {
-    int size = rows * cols;
+char* life_create(int rows, int cols, unsigned int seed, double density) {
+    size_t size = (size_t)rows * cols;
     char *board = (char *)malloc(size * sizeof(char));
     if (!board) return NULL;
 
-    // Use a local copy of seed for rand_r
-    unsigned int state = seed > 0 ? seed : (unsigned int)time(NULL);
+    // Resolve a time-based seed once: every attempt draws from the same key
+    if (seed == 0) seed = (unsigned int)time(NULL);
+
+    // Rejection sampling: draw the next attempt until at least one cell is alive
+    unsigned int attempt = 0;
+    while (life_random(board, 0, rows, cols, (size_t)cols, seed, attempt, density) == 0) {
+        attempt++;
+    }
+
+    return board;
+}
 
-    // Set the current alive cells to 0
-    long alive_count = 0;
+/**
+ * @brief Counters drawn per call of life_philox(): two independent multiply chains overlap.
+ */
+#define LIFE_PHILOX_BLOCKS 2
 
-    // Rejection sampling: repeat until at least one cell is alive
-    do {
-        alive_count = 0;
-        for (int i = 0; i < size; i++) {
-            board[i] = (char)(rand_r(&state) % 2);
-            alive_count += board[i];
+/**
+ * @brief Key and alive limit of a counter-based stream.
+ */
+typedef struct {
+    uint32_t key[2];    // seed and attempt
+    uint32_t limit;     // a word up to it is an alive cell
+} life_philox_t;
+
+/**
+ * @brief Philox4x32-10 (Salmon et al., SC'11) of LIFE_PHILOX_BLOCKS consecutive counters.
+ *
+ * Words 4b..4b+3 of `word` are those of counter first + b. The rounds of
+ * the blocks are interleaved, so the latency of one block's multiplies hides
+ * behind the other's.
+ */
+static void life_philox(const life_philox_t *s, uint64_t first, uint32_t word[4 * LIFE_PHILOX_BLOCKS]) {
+    uint32_t c0[LIFE_PHILOX_BLOCKS], c1[LIFE_PHILOX_BLOCKS], c2[LIFE_PHILOX_BLOCKS], c3[LIFE_PHILOX_BLOCKS];
+    for (int b = 0; b < LIFE_PHILOX_BLOCKS; b++) {
+        c0[b] = (uint32_t)(first + (uint64_t)b);
+        c1[b] = (uint32_t)((first + (uint64_t)b) >> 32);
+        c2[b] = c3[b] = 0;
+    }
+
+    uint32_t k0 = s->key[0], k1 = s->key[1];
+    for (int round = 0; round < 10; round++) {
+        for (int b = 0; b < LIFE_PHILOX_BLOCKS; b++) {
+            uint64_t p0 = (uint64_t)0xD2511F53u * c0[b];
+            uint64_t p1 = (uint64_t)0xCD9E8D57u * c2[b];
+            uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1[b] ^ k0;
+            uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3[b] ^ k1;
+            c1[b] = (uint32_t)p1;
+            c3[b] = (uint32_t)p0;
+            c0[b] = n0;
+            c2[b] = n2;
         }
-    } while (alive_count == 0);
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
 
-    return board;
+    for (int b = 0; b < LIFE_PHILOX_BLOCKS; b++) {
+        word[4 * b]     = c0[b];
+        word[4 * b + 1] = c1[b];
+        word[4 * b + 2] = c2[b];
+        word[4 * b + 3] = c3[b];
+    }
+}
+
+/**
+ * @brief Key the stream with (seed, attempt) and scale the density to a word limit.
+ */
+static void life_philox_init(life_philox_t *s, unsigned int seed, unsigned int attempt, double density) {
+    s->key[0] = seed;
+    s->key[1] = attempt;
+
+    // Words below density·2^32 are alive, at least word 0 (so that any density > 0 can draw a cell)
+    double scaled = density * 4294967296.0;
+    s->limit = scaled >= 4294967296.0 ? UINT32_MAX : scaled < 1.0 ? 0 : (uint32_t)(scaled - 1.0);
+}
+
+/**
+ * @brief Draw `count` cells of global indices n, n+1, ... into `out` (0 or 1).
+ *
+ * @return Number of alive cells drawn.
+ */
+static long life_philox_cells(const life_philox_t *s, uint64_t n, int count, char *out) {
+    uint32_t word[4 * LIFE_PHILOX_BLOCKS];
+    long alive = 0;
+
+    // Cell n is word n & 3 of counter n >> 2; only the first call starts inside a block
+    for (int j = 0; j < count; ) {
+        int skip = (int)((n + (uint64_t)j) & 3);
+        int take = 4 * LIFE_PHILOX_BLOCKS - skip;
+        if (take > count - j) take = count - j;
+
+        life_philox(s, (n + (uint64_t)j) >> 2, word);
+        for (int k = 0; k < take; k++) {
+            out[j + k] = (char)(word[skip + k] <= s->limit);
+            alive     += out[j + k];
+        }
+        j += take;
+    }
+    return alive;
+}
+
+long life_random(char *cells, long first_row, int rows, int cols, size_t stride,
+                 unsigned int seed, unsigned int attempt, double density) {
+    life_philox_t stream;
+    life_philox_init(&stream, seed, attempt, density);
+
+    long alive = 0;
+    for (int i = 0; i < rows; i++) {
+        uint64_t n = (uint64_t)(first_row + i) * (uint64_t)cols;
+        alive += life_philox_cells(&stream, n, cols, cells + (size_t)i * stride);
+    }
+    return alive;
+}
+
+long life_random_packed(uint64_t *words, long first_row, int rows, int cols, size_t stride,
+                        unsigned int seed, unsigned int attempt, double density) {
+    life_philox_t stream;
+    life_philox_init(&stream, seed, attempt, density);
+    char cells[64];
+
+    // One word (64 cells) of the row at a time
+    long alive = 0;
+    for (int i = 0; i < rows; i++) {
+        uint64_t *row = words + (size_t)i * stride;
+        uint64_t n    = (uint64_t)(first_row + i) * (uint64_t)cols;
+        for (int j = 0; j < cols; j += 64) {
+            int take = cols - j < 64 ? cols - j : 64;
+            alive += life_philox_cells(&stream, n + (uint64_t)j, take, cells);
+
+            uint64_t bits = 0;
+            for (int k = 0; k < take; k++) {
+                bits |= (uint64_t)cells[k] << k;
+            }
+            row[j / 64] = bits;
+        }
+    }
+    return alive;
+}
+
+long life_random_lane(uint64_t *words, long first_row, int rows, int cols, size_t stride, int lane,
+                      unsigned int seed, unsigned int attempt, double density) {
+    life_philox_t stream;
+    life_philox_init(&stream, seed, attempt, density);
+    const uint64_t bit = UINT64_C(1) << lane;
+    char cells[256];
+
+    long alive = 0;
+    for (int i = 0; i < rows; i++) {
+        uint64_t *row = words + (size_t)i * stride;
+        uint64_t n    = (uint64_t)(first_row + i) * (uint64_t)cols;
+        for (int j = 0; j < cols; j += 256) {
+            int take = cols - j < 256 ? cols - j : 256;
+            alive += life_philox_cells(&stream, n + (uint64_t)j, take, cells);
+            for (int k = 0; k < take; k++) {
+                row[j + k] = (row[j + k] & ~bit) | ((uint64_t)cells[k] << lane);
+            }
+        }
+    }
+    return alive;
 }
 
 void life_destroy(char *board) {
@@ -44,55 +193,1233 @@ void life_destroy(char *board) {
     }
 }
 
-long life_count(const char *board, int size) {
+long life_count(const char *board, size_t size) {
     long count = 0;
-    for (int i = 0; i < size; i++) {
+    for (size_t i = 0; i < size; i++) {
         count += (board[i] == 1);
     }
     return count;
 }
 
-void life_step(const char *current, char *next, int rows, int cols) {
+/**
+ * @brief Parse a pattern file into `board` (or only measure it when board is NULL).
+ *
+ * Plaintext (.cells): one line per row, 'O' or '*' alive, anything else dead,
+ * lines starting with '!' are comments. RLE: optional '#' comment lines and
+ * an "x = ..., y = ..." header, then runs of b (dead), o (alive) and $ (end of
+ * row) with optional counts, terminated by '!'.
+ */
+static void life_parse(const char *text, char *board, int *rows, int *cols) {
+    int r = 0, c = 0, max_c = 0, is_rle = 0;
+
+    // Skip comments and detect the RLE header
+    const char *p = text;
+    while (*p == '#' || *p == '!' || (*p == 'x' && !is_rle)) {
+        if (*p == 'x') is_rle = 1;
+        while (*p && *p != '\n') p++;
+        if (*p) p++;
+    }
+
+    if (is_rle) {
+        int run = 0;
+        for (; *p && *p != '!'; p++) {
+            if (*p >= '0' && *p <= '9') {
+                run = run * 10 + (*p - '0');
+                continue;
+            }
+            int n = run > 0 ? run : 1;
+            run = 0;
+            if (*p == '$') {
+                r += n;
+                c = 0;
+            } else if (*p == 'b' || *p == 'o') {
+                for (int k = 0; k < n; k++, c++) {
+                    if (board) board[(size_t)r * *cols + c] = (char)(*p == 'o');
+                }
+                if (c > max_c) max_c = c;
+            }
+        }
+        if (c > 0 || r == 0) r++;
+    } else {
+        for (; *p; p++) {
+            if (*p == '\n') {
+                r++;
+                c = 0;
+            } else if (*p != '\r') {
+                if (board) board[(size_t)r * *cols + c] = (char)(*p == 'O' || *p == '*');
+                c++;
+                if (c > max_c) max_c = c;
+            }
+        }
+        if (c > 0) r++;
+    }
+
+    if (!board) {
+        *rows = r;
+        *cols = max_c;
+    }
+}
+
+char* life_load(const char *path, int *rows, int *cols) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    // Read the whole file as a NUL-terminated string
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *text = (length >= 0) ? malloc((size_t)length + 1) : NULL;
+    if (!text || fread(text, 1, (size_t)length, file) != (size_t)length) {
+        free(text);
+        fclose(file);
+        return NULL;
+    }
+    text[length] = '\0';
+    fclose(file);
+
+    life_parse(text, NULL, rows, cols);
+    char *board = NULL;
+    if (*rows > 0 && *cols > 0) {
+        board = calloc((size_t)*rows * *cols, sizeof(char));
+        if (board) life_parse(text, board, rows, cols);
+    }
+    free(text);
+    return board;
+}
+
+int life_pitch(int cols) {
+    // Room for one ghost column on each side, rounded up to a cache line
+    return ((cols + 2 + LIFE_ALIGN - 1) / LIFE_ALIGN) * LIFE_ALIGN;
+}
+
+char* life_alloc(int rows, int cols) {
+    size_t bytes = (size_t)(rows + 2) * life_pitch(cols);
+    void *buf = NULL;
+    if (posix_memalign(&buf, LIFE_ALIGN, bytes) != 0) return NULL;
+
+    // Ghost rows, ghost columns and row padding all start dead
+    memset(buf, 0, bytes);
+    return (char *)buf;
+}
+
+void life_bounds(const char *buf, int rows, int cols, int pitch, int box[4]) {
+    box[0] = rows;
+    box[1] = cols;
+    box[2] = -1;
+    box[3] = -1;
+
+    for (int i = 0; i < rows; i++) {
+        const char *row = buf + (size_t)(i + 1) * pitch + 1;
+
+        // Leftmost alive cell; an empty row leaves the box untouched
+        int left = 0;
+        while (left < cols && !row[left]) left++;
+        if (left == cols) continue;
+
+        int right = cols - 1;
+        while (!row[right]) right--;
+
+        if (box[2] < 0) box[0] = i;
+        box[2] = i;
+        if (left < box[1])  box[1] = left;
+        if (right > box[3]) box[3] = right;
+    }
+}
+
+int life_edge_alive(const char *buf, int rows, int cols, int pitch, int top, int bottom) {
+    char alive = 0;
+
+    // First and last real columns of every row
+    for (int i = 1; i <= rows; i++) {
+        alive |= buf[(size_t)i * pitch + 1] | buf[(size_t)i * pitch + cols];
+    }
+
+    // First and last real rows, for the ranks at the top and bottom of the window
+    const char *first = buf + pitch + 1;
+    const char *last  = buf + (size_t)rows * pitch + 1;
+    for (int j = 0; j < cols; j++) {
+        alive |= (top ? first[j] : 0) | (bottom ? last[j] : 0);
+    }
+
+    return alive != 0;
+}
+
+static const char *boundary_names[LIFE_BOUNDARY_COUNT] = { "cylinder", "torus", "dead", "reflect" };
+
+const char* life_boundary_name(int boundary) {
+    if (boundary < 0 || boundary >= LIFE_BOUNDARY_COUNT) return NULL;
+    return boundary_names[boundary];
+}
+
+/**
+ * @brief Torus: the ghost columns of rows 0..rows+1 take the opposite real column.
+ */
+static void life_edges_torus(char *buf, int rows, int cols, int pitch) {
+    for (int i = 0; i <= rows + 1; i++) {
+        char *row = buf + (size_t)i * pitch;
+        row[0]        = row[cols];
+        row[cols + 1] = row[1];
+    }
+}
+
+/**
+ * @brief Reflect: the outer ghost rows and the ghost columns copy the adjacent real cells.
+ */
+static void life_edges_reflect(char *buf, int rows, int cols, int pitch, int top, int bottom) {
+    if (top)    memcpy(buf, buf + pitch, pitch);
+    if (bottom) memcpy(buf + (size_t)(rows + 1) * pitch, buf + (size_t)rows * pitch, pitch);
+
+    for (int i = 0; i <= rows + 1; i++) {
+        char *row = buf + (size_t)i * pitch;
+        row[0]        = row[1];
+        row[cols + 1] = row[cols];
+    }
+}
+
+void life_fill_edges(char *buf, int rows, int cols, int pitch, int boundary, int top, int bottom) {
+    if (boundary == LIFE_BOUNDARY_TORUS) {
+        life_edges_torus(buf, rows, cols, pitch);
+    } else if (boundary == LIFE_BOUNDARY_REFLECT) {
+        life_edges_reflect(buf, rows, cols, pitch, top, bottom);
+    }
+    // Cylinder and dead: the ghost columns stay dead
+}
+
+/* ********************************************************************************************* */
+
+/* Rule applied by every kernel and engine (see life_set_rule()) */
+static unsigned life_rule = LIFE_RULE_LIFE;
+
+int life_parse_rule(const char *text, unsigned *rule) {
+    unsigned birth = 0, survive = 0;
+    int seen_b = 0, seen_s = 0;
+    const char *p = text;
+
+    // Two parts, "B<digits>" and "S<digits>" in either order, separated by '/'
+    for (int part = 0; part < 2; part++) {
+        unsigned *mask;
+        char c = (char)toupper((unsigned char)*p);
+        if (c == 'B' && !seen_b) {
+            seen_b = 1;
+            mask   = &birth;
+        } else if (c == 'S' && !seen_s) {
+            seen_s = 1;
+            mask   = &survive;
+        } else {
+            return -1;
+        }
+        for (p++; *p >= '0' && *p <= '8'; p++) {
+            *mask |= 1u << (*p - '0');
+        }
+        if (part == 0) {
+            if (*p != '/') return -1;
+            p++;
+        }
+    }
+
+    // B0 would turn the dead surroundings of the board alive
+    if (*p != '\0' || (birth & 1)) return -1;
+
+    *rule = LIFE_RULE(birth, survive);
+    return 0;
+}
+
+void life_format_rule(unsigned rule, char *buf) {
+    char *p = buf;
+    *p++ = 'B';
+    for (int n = 0; n <= 8; n++) {
+        if ((rule >> n) & 1) *p++ = (char)('0' + n);
+    }
+    *p++ = '/';
+    *p++ = 'S';
+    for (int n = 0; n <= 8; n++) {
+        if ((rule >> (9 + n)) & 1) *p++ = (char)('0' + n);
+    }
+    *p = '\0';
+}
+
+unsigned life_get_rule(void) {
+    return life_rule;
+}
+
+void life_stats_set(life_stats_t *stats, long alive, long births, long deaths) {
+    stats->alive   = alive;
+    stats->births  = births;
+    stats->deaths  = deaths;
+    stats->changed = (births + deaths) > 0;
+}
+
+/**
+ * @brief Next state of a cell with `n` alive neighbors under `rule`.
+ *
+ * Same as LIFE_RULE_NEXT(), but Life is spelled out as compares: with a
+ * constant rule this folds into the form the compiler can vectorize.
+ */
+static inline char life_next(unsigned rule, char is_alive, int n) {
+    if (rule == LIFE_RULE_LIFE) {
+        // Alive next iff 3 neighbors, or 2 neighbors and alive now
+        return (char)((n == 3) | ((n == 2) & is_alive));
+    }
+    return (char)LIFE_RULE_NEXT(rule, is_alive, n);
+}
+
+/**
+ * @brief Body of life_step_scalar() for a given rule.
+ *
+ * Inlined with a constant `rule` for Life, so that life_next() folds into
+ * compares and the compiler can vectorize the sweep.
+ */
+static inline void life_scalar_rule(const char *current, char *next, int rows, int cols, int pitch,
+                                    life_stats_t *stats, unsigned rule) {
+    long alive = 0, births = 0, deaths = 0;
+
     // Init a board scan of the current section
     for (int i = 1; i <= rows; i++) {
-        for (int j = 0; j < cols; j++) {
+        for (int j = 1; j <= cols; j++) {
             int alive_neighbors = 0;
 
-            // Scan the 3×3 neighborhood: rows i-1, i, i+1
+            // Scan the 3×3 neighborhood: rows i-1, i, i+1 and columns j-1, j, j+1.
+            // Column 0 and cols+1 are ghost columns, so no bounds check is needed
             for (int di = -1; di <= 1; di++) {
                 int row_idx = i + di;
                 for (int dj = -1; dj <= 1; dj++) {
-                    int col_idx = j + dj;
                     if (di == 0 && dj == 0) continue;
-                    if (col_idx < 0 || col_idx >= cols) continue;
-                    
-                    // Linear index into flat array of size (rows+2)*cols
-                    alive_neighbors += current[row_idx * cols + col_idx];
+
+                    // Linear index into flat array of size (rows+2)*pitch
+                    alive_neighbors += current[(size_t)row_idx * pitch + j + dj];
                 }
             }
 
-            // Current cell state
-            char is_alive = current[i * cols + j];
-            char new_state = 0;
+            // Current cell state; birth (dead) or survival (alive) bit of the rule
+            char is_alive  = current[(size_t)i * pitch + j];
+            char new_state = life_next(rule, is_alive, alive_neighbors);
+            next[(size_t)i * pitch + j] = new_state;
 
-            if (is_alive) {
-                if (alive_neighbors < 2) {
-                    new_state = 0;  // underpopulation
-                } else if (alive_neighbors <= 3) {
-                    new_state = 1;  // survival
-                } else {
-                    new_state = 0;  // overpopulation
+            // Same sweep: population and transitions of the new generation
+            alive  += new_state;
+            births += new_state & !is_alive;
+            deaths += is_alive & !new_state;
+        }
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+void life_step_scalar(const char *current, char *next, int rows, int cols, int pitch,
+                      life_stats_t *stats) {
+    if (life_rule == LIFE_RULE_LIFE) {
+        life_scalar_rule(current, next, rows, cols, pitch, stats, LIFE_RULE_LIFE);
+    } else {
+        life_scalar_rule(current, next, rows, cols, pitch, stats, life_rule);
+    }
+}
+
+/**
+ * @brief Next state of the cell at column j of row `mid` (branch-free).
+ *
+ * `up` and `dn` point to the same column of the rows above and below; ghost
+ * columns make j-1 and j+1 always valid. Used by the SIMD kernels for the
+ * row tails shorter than a vector (`rule` is a constant in the specialized ones).
+ */
+static inline char life_cell(const char *up, const char *mid, const char *dn, int j, unsigned rule) {
+    int alive_neighbors = up[j - 1] + up[j] + up[j + 1]
+                        + mid[j - 1]        + mid[j + 1]
+                        + dn[j - 1] + dn[j] + dn[j + 1];
+
+    return life_next(rule, mid[j], alive_neighbors);
+}
+
+#ifdef LIFE_X86
+
+/*
+ * The SSE2/AVX2 kernels are stamped out once per rule variant by
+ * LIFE_SSE2_KERNEL / LIFE_AVX2_KERNEL. STATE(sum, alive, rule) maps the
+ * neighbor sums and the current cells (0/1 bytes) to the next cells (0/1
+ * bytes); SETUP declares what the generic variant needs before the loop.
+ * In the specialized variants `rule` is a compile-time constant, so every
+ * test on its bits folds away and the loop is a fixed set of byte compares.
+ */
+
+#define LIFE_SSE2_KERNEL(name, RULE, SETUP, STATE)                                              \
+__attribute__((target("sse2")))                                                                 \
+void name(const char *current, char *next, int rows, int cols, int pitch,                       \
+          life_stats_t *stats) {                                                                \
+    const unsigned rule = (RULE);                                                               \
+    const __m128i one   = _mm_set1_epi8(1);                                                     \
+    const __m128i zero  = _mm_setzero_si128();                                                  \
+    SETUP                                                                                       \
+    (void)one;                                                                                  \
+                                                                                                \
+    /* Per-lane (64-bit) sums of alive cells, births and deaths */                              \
+    __m128i acc_alive  = zero;                                                                  \
+    __m128i acc_births = zero;                                                                  \
+    __m128i acc_deaths = zero;                                                                  \
+    long alive = 0, births = 0, deaths = 0;                                                     \
+                                                                                                \
+    for (int i = 1; i <= rows; i++) {                                                           \
+        const char *up  = current + (size_t)(i - 1) * pitch;                                    \
+        const char *mid = current + (size_t)i * pitch;                                          \
+        const char *dn  = current + (size_t)(i + 1) * pitch;                                    \
+        char *out       = next + (size_t)i * pitch;                                             \
+                                                                                                \
+        /* 16 cells per iteration, ghost columns cover both borders */                          \
+        int j = 1;                                                                              \
+        for (; j + 16 <= cols + 1; j += 16) {                                                   \
+            __m128i sum = _mm_add_epi8(                                                         \
+                _mm_add_epi8(_mm_loadu_si128((const __m128i *)(up + j - 1)),                    \
+                             _mm_loadu_si128((const __m128i *)(up + j))),                       \
+                _mm_add_epi8(_mm_loadu_si128((const __m128i *)(up + j + 1)),                    \
+                             _mm_loadu_si128((const __m128i *)(mid + j - 1))));                 \
+            sum = _mm_add_epi8(sum,                                                             \
+                _mm_add_epi8(                                                                   \
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *)(mid + j + 1)),               \
+                                 _mm_loadu_si128((const __m128i *)(dn + j - 1))),               \
+                    _mm_add_epi8(_mm_loadu_si128((const __m128i *)(dn + j)),                    \
+                                 _mm_loadu_si128((const __m128i *)(dn + j + 1)))));             \
+                                                                                                \
+            __m128i alive = _mm_loadu_si128((const __m128i *)(mid + j));                        \
+            __m128i state = STATE(sum, alive, rule);                                            \
+            _mm_storeu_si128((__m128i *)(out + j), state);                                      \
+                                                                                                \
+            /* Horizontal byte sums (psadbw) of new, born (~alive & new) and dead (~new & alive) */ \
+            acc_alive  = _mm_add_epi64(acc_alive,  _mm_sad_epu8(state, zero));                  \
+            acc_births = _mm_add_epi64(acc_births, _mm_sad_epu8(_mm_andnot_si128(alive, state), zero)); \
+            acc_deaths = _mm_add_epi64(acc_deaths, _mm_sad_epu8(_mm_andnot_si128(state, alive), zero)); \
+        }                                                                                       \
+                                                                                                \
+        /* Tail shorter than a vector */                                                        \
+        for (; j <= cols; j++) {                                                                \
+            out[j] = life_cell(up, mid, dn, j, rule);                                           \
+            alive  += out[j];                                                                   \
+            births += out[j] & !mid[j];                                                         \
+            deaths += mid[j] & !out[j];                                                         \
+        }                                                                                       \
+    }                                                                                           \
+                                                                                                \
+    uint64_t lanes[3][2];                                                                       \
+    _mm_storeu_si128((__m128i *)lanes[0], acc_alive);                                           \
+    _mm_storeu_si128((__m128i *)lanes[1], acc_births);                                          \
+    _mm_storeu_si128((__m128i *)lanes[2], acc_deaths);                                          \
+    life_stats_set(stats,                                                                       \
+                   alive  + (long)(lanes[0][0] + lanes[0][1]),                                  \
+                   births + (long)(lanes[1][0] + lanes[1][1]),                                  \
+                   deaths + (long)(lanes[2][0] + lanes[2][1]));                                 \
+}
+
+#define LIFE_AVX2_KERNEL(name, RULE, SETUP, STATE)                                              \
+__attribute__((target("avx2")))                                                                 \
+void name(const char *current, char *next, int rows, int cols, int pitch,                       \
+          life_stats_t *stats) {                                                                \
+    const unsigned rule = (RULE);                                                               \
+    const __m256i one   = _mm256_set1_epi8(1);                                                  \
+    const __m256i zero  = _mm256_setzero_si256();                                               \
+    SETUP                                                                                       \
+    (void)one;                                                                                  \
+                                                                                                \
+    /* Per-lane (64-bit) sums of alive cells, births and deaths */                              \
+    __m256i acc_alive  = zero;                                                                  \
+    __m256i acc_births = zero;                                                                  \
+    __m256i acc_deaths = zero;                                                                  \
+    long alive = 0, births = 0, deaths = 0;                                                     \
+                                                                                                \
+    for (int i = 1; i <= rows; i++) {                                                           \
+        const char *up  = current + (size_t)(i - 1) * pitch;                                    \
+        const char *mid = current + (size_t)i * pitch;                                          \
+        const char *dn  = current + (size_t)(i + 1) * pitch;                                    \
+        char *out       = next + (size_t)i * pitch;                                             \
+                                                                                                \
+        /* 32 cells per iteration, ghost columns cover both borders */                          \
+        int j = 1;                                                                              \
+        for (; j + 32 <= cols + 1; j += 32) {                                                   \
+            __m256i sum = _mm256_add_epi8(                                                      \
+                _mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(up + j - 1)),              \
+                                _mm256_loadu_si256((const __m256i *)(up + j))),                 \
+                _mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(up + j + 1)),              \
+                                _mm256_loadu_si256((const __m256i *)(mid + j - 1))));           \
+            sum = _mm256_add_epi8(sum,                                                          \
+                _mm256_add_epi8(                                                                \
+                    _mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(mid + j + 1)),         \
+                                    _mm256_loadu_si256((const __m256i *)(dn + j - 1))),         \
+                    _mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(dn + j)),              \
+                                    _mm256_loadu_si256((const __m256i *)(dn + j + 1)))));       \
+                                                                                                \
+            __m256i alive = _mm256_loadu_si256((const __m256i *)(mid + j));                     \
+            __m256i state = STATE(sum, alive, rule);                                            \
+            _mm256_storeu_si256((__m256i *)(out + j), state);                                   \
+                                                                                                \
+            /* Horizontal byte sums (vpsadbw) of new, born (~alive & new) and dead (~new & alive) */ \
+            acc_alive  = _mm256_add_epi64(acc_alive,  _mm256_sad_epu8(state, zero));            \
+            acc_births = _mm256_add_epi64(acc_births, _mm256_sad_epu8(_mm256_andnot_si256(alive, state), zero)); \
+            acc_deaths = _mm256_add_epi64(acc_deaths, _mm256_sad_epu8(_mm256_andnot_si256(state, alive), zero)); \
+        }                                                                                       \
+                                                                                                \
+        /* Tail shorter than a vector */                                                        \
+        for (; j <= cols; j++) {                                                                \
+            out[j] = life_cell(up, mid, dn, j, rule);                                           \
+            alive  += out[j];                                                                   \
+            births += out[j] & !mid[j];                                                         \
+            deaths += mid[j] & !out[j];                                                         \
+        }                                                                                       \
+    }                                                                                           \
+                                                                                                \
+    uint64_t lanes[3][4];                                                                       \
+    _mm256_storeu_si256((__m256i *)lanes[0], acc_alive);                                        \
+    _mm256_storeu_si256((__m256i *)lanes[1], acc_births);                                       \
+    _mm256_storeu_si256((__m256i *)lanes[2], acc_deaths);                                       \
+    life_stats_set(stats,                                                                       \
+                   alive  + (long)(lanes[0][0] + lanes[0][1] + lanes[0][2] + lanes[0][3]),      \
+                   births + (long)(lanes[1][0] + lanes[1][1] + lanes[1][2] + lanes[1][3]),      \
+                   deaths + (long)(lanes[2][0] + lanes[2][1] + lanes[2][2] + lanes[2][3]));     \
+}
+
+/* B3/S23: (sum == 3) | (sum == 2 & alive), as 0/1 bytes */
+#define LIFE_SSE2_STATE_LIFE(sum, alive, rule)                                  \
+    _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi8(sum, _mm_set1_epi8(3)), one),     \
+                 _mm_and_si128(_mm_cmpeq_epi8(sum, _mm_set1_epi8(2)), alive))
+#define LIFE_AVX2_STATE_LIFE(sum, alive, rule)                                        \
+    _mm256_or_si256(_mm256_and_si256(_mm256_cmpeq_epi8(sum, _mm256_set1_epi8(3)), one), \
+                    _mm256_and_si256(_mm256_cmpeq_epi8(sum, _mm256_set1_epi8(2)), alive))
+
+/* Constant rule: OR of the compares for the counts in the mask (the others fold to zero) */
+#define LIFE_SSE2_EQ(sum, mask, n) ((((mask) >> (n)) & 1) ? _mm_cmpeq_epi8(sum, _mm_set1_epi8(n)) : zero)
+#define LIFE_SSE2_ANY(sum, mask)                                                                    \
+    _mm_or_si128(_mm_or_si128(_mm_or_si128(LIFE_SSE2_EQ(sum, mask, 0), LIFE_SSE2_EQ(sum, mask, 1)),  \
+                              _mm_or_si128(LIFE_SSE2_EQ(sum, mask, 2), LIFE_SSE2_EQ(sum, mask, 3))), \
+                 _mm_or_si128(_mm_or_si128(LIFE_SSE2_EQ(sum, mask, 4), LIFE_SSE2_EQ(sum, mask, 5)),  \
+                              _mm_or_si128(_mm_or_si128(LIFE_SSE2_EQ(sum, mask, 6),                  \
+                                                        LIFE_SSE2_EQ(sum, mask, 7)),                 \
+                                           LIFE_SSE2_EQ(sum, mask, 8))))
+#define LIFE_SSE2_STATE_MASK(sum, alive, rule)                                              \
+    _mm_and_si128(one, _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi8(alive, one),            \
+                                                     LIFE_SSE2_ANY(sum, (rule) & 0x1FF)),   \
+                                    _mm_and_si128(_mm_cmpeq_epi8(alive, one),               \
+                                                  LIFE_SSE2_ANY(sum, (rule) >> 9))))
+
+#define LIFE_AVX2_EQ(sum, mask, n) ((((mask) >> (n)) & 1) ? _mm256_cmpeq_epi8(sum, _mm256_set1_epi8(n)) : zero)
+#define LIFE_AVX2_ANY(sum, mask)                                                                         \
+    _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(LIFE_AVX2_EQ(sum, mask, 0), LIFE_AVX2_EQ(sum, mask, 1)),  \
+                                    _mm256_or_si256(LIFE_AVX2_EQ(sum, mask, 2), LIFE_AVX2_EQ(sum, mask, 3))), \
+                    _mm256_or_si256(_mm256_or_si256(LIFE_AVX2_EQ(sum, mask, 4), LIFE_AVX2_EQ(sum, mask, 5)),  \
+                                    _mm256_or_si256(_mm256_or_si256(LIFE_AVX2_EQ(sum, mask, 6),               \
+                                                                    LIFE_AVX2_EQ(sum, mask, 7)),              \
+                                                    LIFE_AVX2_EQ(sum, mask, 8))))
+#define LIFE_AVX2_STATE_MASK(sum, alive, rule)                                                 \
+    _mm256_and_si256(one, _mm256_or_si256(_mm256_andnot_si256(_mm256_cmpeq_epi8(alive, one),   \
+                                                              LIFE_AVX2_ANY(sum, (rule) & 0x1FF)), \
+                                          _mm256_and_si256(_mm256_cmpeq_epi8(alive, one),      \
+                                                           LIFE_AVX2_ANY(sum, (rule) >> 9))))
+
+/* Runtime rule, SSE2: one 0x00/0xFF mask per count and per B/S list, applied to all 9 compares */
+#define LIFE_SSE2_SETUP_GENERIC                                                 \
+    __m128i birth_mask[9], survive_mask[9];                                     \
+    for (int n = 0; n <= 8; n++) {                                              \
+        birth_mask[n]   = _mm_set1_epi8((char)-(int)((rule >> n) & 1));         \
+        survive_mask[n] = _mm_set1_epi8((char)-(int)((rule >> (9 + n)) & 1));   \
+    }
+#define LIFE_SSE2_STATE_GENERIC(sum, alive, rule) \
+    life_sse2_rule(sum, alive, birth_mask, survive_mask)
+
+__attribute__((target("sse2")))
+static inline __m128i life_sse2_rule(__m128i sum, __m128i alive,
+                                     const __m128i *birth_mask, const __m128i *survive_mask) {
+    __m128i born = _mm_setzero_si128(), keep = _mm_setzero_si128();
+    for (int n = 0; n <= 8; n++) {
+        __m128i eq = _mm_cmpeq_epi8(sum, _mm_set1_epi8((char)n));
+        born = _mm_or_si128(born, _mm_and_si128(eq, birth_mask[n]));
+        keep = _mm_or_si128(keep, _mm_and_si128(eq, survive_mask[n]));
+    }
+    __m128i is_alive = _mm_cmpeq_epi8(alive, _mm_set1_epi8(1));
+    return _mm_and_si128(_mm_set1_epi8(1),
+                         _mm_or_si128(_mm_andnot_si128(is_alive, born), _mm_and_si128(is_alive, keep)));
+}
+
+/* Runtime rule, AVX2: the B and S lists as 16-entry byte tables, looked up by count (vpshufb) */
+#define LIFE_AVX2_SETUP_GENERIC                                                 \
+    char birth_table[32] = { 0 }, survive_table[32] = { 0 };                    \
+    for (int n = 0; n <= 8; n++) {                                              \
+        birth_table[n]   = birth_table[16 + n]   = (char)((rule >> n) & 1);     \
+        survive_table[n] = survive_table[16 + n] = (char)((rule >> (9 + n)) & 1); \
+    }                                                                           \
+    const __m256i birth_lut   = _mm256_loadu_si256((const __m256i *)birth_table);   \
+    const __m256i survive_lut = _mm256_loadu_si256((const __m256i *)survive_table);
+#define LIFE_AVX2_STATE_GENERIC(sum, alive, rule)                                         \
+    _mm256_blendv_epi8(_mm256_shuffle_epi8(birth_lut, sum), _mm256_shuffle_epi8(survive_lut, sum), \
+                       _mm256_cmpeq_epi8(alive, one))
+
+LIFE_SSE2_KERNEL(life_step_sse2, LIFE_RULE_LIFE, , LIFE_SSE2_STATE_LIFE)
+static LIFE_SSE2_KERNEL(life_step_sse2_highlife, LIFE_RULE_HIGHLIFE, , LIFE_SSE2_STATE_MASK)
+static LIFE_SSE2_KERNEL(life_step_sse2_daynight, LIFE_RULE_DAYNIGHT, , LIFE_SSE2_STATE_MASK)
+static LIFE_SSE2_KERNEL(life_step_sse2_seeds,    LIFE_RULE_SEEDS,    , LIFE_SSE2_STATE_MASK)
+static LIFE_SSE2_KERNEL(life_step_sse2_rule,     life_rule, LIFE_SSE2_SETUP_GENERIC, LIFE_SSE2_STATE_GENERIC)
+
+LIFE_AVX2_KERNEL(life_step_avx2, LIFE_RULE_LIFE, , LIFE_AVX2_STATE_LIFE)
+static LIFE_AVX2_KERNEL(life_step_avx2_highlife, LIFE_RULE_HIGHLIFE, , LIFE_AVX2_STATE_MASK)
+static LIFE_AVX2_KERNEL(life_step_avx2_daynight, LIFE_RULE_DAYNIGHT, , LIFE_AVX2_STATE_MASK)
+static LIFE_AVX2_KERNEL(life_step_avx2_seeds,    LIFE_RULE_SEEDS,    , LIFE_AVX2_STATE_MASK)
+static LIFE_AVX2_KERNEL(life_step_avx2_rule,     life_rule, LIFE_AVX2_SETUP_GENERIC, LIFE_AVX2_STATE_GENERIC)
+
+#else
+
+void life_step_sse2(const char *current, char *next, int rows, int cols, int pitch,
+                    life_stats_t *stats) {
+    life_step_scalar(current, next, rows, cols, pitch, stats);
+}
+
+void life_step_avx2(const char *current, char *next, int rows, int cols, int pitch,
+                    life_stats_t *stats) {
+    life_step_scalar(current, next, rows, cols, pitch, stats);
+}
+
+#endif // LIFE_X86
+
+/* Column sums of life_step_colsum(), kept across calls and grown to the widest board seen,
+   so the per-generation path never allocates (freed by life_kernel_release()) */
+static unsigned char *colsum_row  = NULL;
+static int            colsum_size = 0;
+
+void life_step_colsum(const char *current, char *next, int rows, int cols, int pitch,
+                      life_stats_t *stats) {
+    // Vertical sums of rows i-1, i, i+1 for every padded column 0..cols+1
+    if (colsum_size < cols + 2) {
+        unsigned char *grown = realloc(colsum_row, (size_t)(cols + 2));
+        if (!grown) {
+            life_step_scalar(current, next, rows, cols, pitch, stats);
+            return;
+        }
+        colsum_row  = grown;
+        colsum_size = cols + 2;
+    }
+    unsigned char *colsum = colsum_row;
+
+    const unsigned rule = life_rule;
+    long alive = 0, births = 0, deaths = 0;
+
+    // Prime the sums for row 1 (ghost row 0, row 1, row 2)
+    for (int j = 0; j <= cols + 1; j++) {
+        colsum[j] = (unsigned char)(current[j] + current[pitch + j] + current[2 * pitch + j]);
+    }
+
+    for (int i = 1; i <= rows; i++) {
+        const char *mid = current + (size_t)i * pitch;
+        char *out       = next + (size_t)i * pitch;
+
+        // Horizontal 3-wide window over the column sums, slid one column at a time
+        int window = colsum[0] + colsum[1];
+        for (int j = 1; j <= cols; j++) {
+            window += colsum[j + 1];
+
+            // The window includes the cell itself
+            int alive_neighbors = window - mid[j];
+            char is_alive  = mid[j];
+            char new_state = (char)LIFE_RULE_NEXT(rule, is_alive, alive_neighbors);
+            out[j] = new_state;
+
+            alive  += new_state;
+            births += new_state & !is_alive;
+            deaths += is_alive & !new_state;
+
+            window -= colsum[j - 1];
+        }
+
+        // Slide the column sums down one row: add row i+2, drop row i-1
+        if (i < rows) {
+            const char *drop = current + (size_t)(i - 1) * pitch;
+            const char *add  = current + (size_t)(i + 2) * pitch;
+            for (int j = 0; j <= cols + 1; j++) {
+                colsum[j] = (unsigned char)(colsum[j] + add[j] - drop[j]);
+            }
+        }
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/* Next 2×2 center of every 4×4 block: bit (r*4 + c) of the index is cell (r,c),
+   bit ((r-1)*2 + (c-1)) of the entry is the next state of center cell (r,c) */
+static uint8_t life_lut[1 << 16];
+static unsigned life_lut_rule = ~0u;   // rule the table was built for (none yet)
+
+void life_lut_init(void) {
+    if (life_lut_rule == life_rule) return;
+
+    for (int idx = 0; idx < (1 << 16); idx++) {
+        uint8_t result = 0;
+        for (int r = 1; r <= 2; r++) {
+            for (int c = 1; c <= 2; c++) {
+                int alive_neighbors = 0;
+                for (int dr = -1; dr <= 1; dr++) {
+                    for (int dc = -1; dc <= 1; dc++) {
+                        if (dr == 0 && dc == 0) continue;
+                        alive_neighbors += (idx >> ((r + dr) * 4 + (c + dc))) & 1;
+                    }
+                }
+                int is_alive = (idx >> (r * 4 + c)) & 1;
+                int new_state = (int)LIFE_RULE_NEXT(life_rule, is_alive, alive_neighbors);
+                result |= (uint8_t)(new_state << ((r - 1) * 2 + (c - 1)));
+            }
+        }
+        life_lut[idx] = result;
+    }
+    life_lut_rule = life_rule;
+}
+
+void life_step_lut(const char *current, char *next, int rows, int cols, int pitch,
+                   life_stats_t *stats) {
+    life_lut_init();
+
+    long alive = 0, births = 0, deaths = 0;
+    int i = 1;
+
+    // Two rows at a time: a 4×4 window (rows i-1..i+2) yields the 2×2 block (i..i+1, j..j+1)
+    for (; i + 1 <= rows; i += 2) {
+        const char *p[4] = {
+            current + (size_t)(i - 1) * pitch, current + (size_t)i * pitch,
+            current + (size_t)(i + 1) * pitch, current + (size_t)(i + 2) * pitch
+        };
+        char *out0 = next + (size_t)i * pitch;
+        char *out1 = next + (size_t)(i + 1) * pitch;
+
+        // Rolling nibbles: bits 0,1 hold columns j-1, j of each window row
+        unsigned n[4];
+        for (int r = 0; r < 4; r++) {
+            n[r] = (unsigned)p[r][0] | ((unsigned)p[r][1] << 1);
+        }
+
+        int j = 1;
+        for (; j + 1 <= cols; j += 2) {
+            // Shift in columns j+1, j+2 as bits 2,3
+            for (int r = 0; r < 4; r++) {
+                n[r] |= ((unsigned)p[r][j + 1] << 2) | ((unsigned)p[r][j + 2] << 3);
+            }
+
+            unsigned idx = n[0] | (n[1] << 4) | (n[2] << 8) | (n[3] << 12);
+            unsigned res = life_lut[idx];
+            unsigned cur = ((n[1] >> 1) & 3) | (((n[2] >> 1) & 3) << 2);
+
+            out0[j]     = (char)(res & 1);
+            out0[j + 1] = (char)((res >> 1) & 1);
+            out1[j]     = (char)((res >> 2) & 1);
+            out1[j + 1] = (char)((res >> 3) & 1);
+
+            alive  += __builtin_popcount(res);
+            births += __builtin_popcount(res & ~cur);
+            deaths += __builtin_popcount(cur & ~res);
+
+            // Columns j+1, j+2 become columns j-1, j of the next window
+            for (int r = 0; r < 4; r++) {
+                n[r] >>= 2;
+            }
+        }
+
+        // Odd number of columns: last column per cell
+        for (; j <= cols; j++) {
+            for (int r = 1; r <= 2; r++) {
+                char is_alive  = p[r][j];
+                char new_state = life_cell(p[r - 1], p[r], p[r + 1], j, life_rule);
+                (r == 1 ? out0 : out1)[j] = new_state;
+                alive  += new_state;
+                births += new_state & !is_alive;
+                deaths += is_alive & !new_state;
+            }
+        }
+    }
+
+    // Odd number of rows: last row per cell
+    for (; i <= rows; i++) {
+        const char *up  = current + (size_t)(i - 1) * pitch;
+        const char *mid = current + (size_t)i * pitch;
+        const char *dn  = current + (size_t)(i + 1) * pitch;
+        for (int j = 1; j <= cols; j++) {
+            char new_state = life_cell(up, mid, dn, j, life_rule);
+            next[(size_t)i * pitch + j] = new_state;
+            alive  += new_state;
+            births += new_state & !mid[j];
+            deaths += mid[j] & !new_state;
+        }
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/**
+ * @brief Gather an 8×8 block as a 64-bit mask, bit (r*8 + c) = cell (r0+r, c0+c).
+ *
+ * r0 is a padded row index in [0, nrows), c0 a 0-based data column; cells
+ * outside the buffer or outside [0, cols) read as dead.
+ */
+static uint64_t life_gather8x8(const char *buf, int r0, int c0, int nrows, int cols, int pitch) {
+    uint64_t block = 0;
+    int interior = r0 >= 0 && r0 + 8 <= nrows && c0 >= 0 && c0 + 8 <= cols;
+
+    for (int r = 0; r < 8; r++) {
+        if (!interior && (r0 + r < 0 || r0 + r >= nrows)) continue;
+        const char *row = buf + (size_t)(r0 + r) * pitch + 1;
+        for (int c = 0; c < 8; c++) {
+            if (!interior && (c0 + c < 0 || c0 + c >= cols)) continue;
+            block |= (uint64_t)(row[c0 + c] & 1) << (r * 8 + c);
+        }
+    }
+    return block;
+}
+
+/**
+ * @brief Table index of the 4×4 window at (r,c) of an 8×8 block mask.
+ */
+static inline unsigned life_window4x4(uint64_t block, int r, int c) {
+    return (unsigned)(((block >> (r * 8 + c)) & 0xF)
+                   | (((block >> ((r + 1) * 8 + c)) & 0xF) << 4)
+                   | (((block >> ((r + 2) * 8 + c)) & 0xF) << 8)
+                   | (((block >> ((r + 3) * 8 + c)) & 0xF) << 12));
+}
+
+/**
+ * @brief Place a 2×2 table entry at (r,c) of an 8×8 block mask.
+ */
+static inline uint64_t life_place2x2(unsigned res, int r, int c) {
+    return ((uint64_t)(res & 3) << (r * 8 + c))
+         | ((uint64_t)((res >> 2) & 3) << ((r + 1) * 8 + c));
+}
+
+void life_step2_lut(const char *current, char *next, int rows, int cols, int pitch,
+                    life_stats_t *stats, long *gen_alive) {
+    life_lut_init();
+
+    long alive = 0, births = 0, deaths = 0, alive_mid = 0;
+    int nrows = rows + 4;
+
+    // One 8×8 input block (rows R-2..R+5, columns C-2..C+5) per 4×4 output block
+    for (int R = 2; R < rows + 2; R += 4) {
+        for (int C = 0; C < cols; C += 4) {
+            uint64_t in = life_gather8x8(current, R - 2, C - 2, nrows, cols, pitch);
+
+            // Generation +1 on the 6×6 core (positions 1..6): 9 lookups
+            uint64_t mid = 0;
+            for (int r = 0; r <= 4; r += 2) {
+                for (int c = 0; c <= 4; c += 2) {
+                    mid |= life_place2x2(life_lut[life_window4x4(in, r, c)], r + 1, c + 1);
                 }
+            }
+
+            // Columns outside the board stay dead in the intermediate generation
+            for (int c = 1; c <= 6; c++) {
+                if (C - 2 + c < 0 || C - 2 + c >= cols) {
+                    mid &= ~(UINT64_C(0x0101010101010101) << c);
+                }
+            }
+
+            // Generation +2 on the 4×4 center (positions 2..5): 4 lookups
+            uint64_t out = 0;
+            for (int r = 1; r <= 3; r += 2) {
+                for (int c = 1; c <= 3; c += 2) {
+                    out |= life_place2x2(life_lut[life_window4x4(mid, r, c)], r + 1, c + 1);
+                }
+            }
+
+            // Write the cells of the block that lie on the slab
+            for (int r = 2; r <= 5; r++) {
+                int i = R - 2 + r;
+                if (i >= rows + 2) break;
+                for (int c = 2; c <= 5; c++) {
+                    int j = C - 2 + c;
+                    if (j >= cols) break;
+                    int prev_state = (int)((mid >> (r * 8 + c)) & 1);
+                    int new_state  = (int)((out >> (r * 8 + c)) & 1);
+                    next[(size_t)i * pitch + 1 + j] = (char)new_state;
+
+                    // Transitions of the last generation (+1 → +2)
+                    alive_mid += prev_state;
+                    alive     += new_state;
+                    births    += new_state & !prev_state;
+                    deaths    += prev_state & !new_state;
+                }
+            }
+        }
+    }
+
+    if (gen_alive) {
+        gen_alive[0] = alive_mid;
+        gen_alive[1] = alive;
+    }
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/* Kernel table, indexed by LIFE_KERNEL_* */
+typedef void (*life_kernel_fn)(const char *, char *, int, int, int, life_stats_t *);
+
+static const char *kernel_names[LIFE_KERNEL_COUNT] = { "auto", "scalar", "sse2", "avx2", "colsum", "lut" };
+static const life_kernel_fn kernel_fns[LIFE_KERNEL_COUNT] = {
+    NULL, life_step_scalar, life_step_sse2, life_step_avx2, life_step_colsum, life_step_lut
+};
+
+/* Candidates tried by LIFE_KERNEL_AUTO, widest first */
+static const int kernel_auto_order[] = { LIFE_KERNEL_AVX2, LIFE_KERNEL_SSE2, LIFE_KERNEL_SCALAR };
+
+#ifdef LIFE_X86
+/* Rules with specialized SIMD variants; any other rule uses the last (generic) entry */
+static const unsigned rule_variants[] = { LIFE_RULE_LIFE, LIFE_RULE_HIGHLIFE, LIFE_RULE_DAYNIGHT, LIFE_RULE_SEEDS };
+#define LIFE_RULE_VARIANTS (sizeof(rule_variants) / sizeof(rule_variants[0]))
+
+static const life_kernel_fn sse2_variants[LIFE_RULE_VARIANTS + 1] = {
+    life_step_sse2, life_step_sse2_highlife, life_step_sse2_daynight, life_step_sse2_seeds, life_step_sse2_rule
+};
+static const life_kernel_fn avx2_variants[LIFE_RULE_VARIANTS + 1] = {
+    life_step_avx2, life_step_avx2_highlife, life_step_avx2_daynight, life_step_avx2_seeds, life_step_avx2_rule
+};
+#endif
+
+/* Kernel used by life_step(), resolved on first use if not selected */
+static life_kernel_fn active_kernel = NULL;
+static int active_id = LIFE_KERNEL_AUTO;
+
+/**
+ * @brief Variant of a (supported, concrete) kernel for the current rule.
+ *
+ * The scalar, colsum and lut kernels read the rule at runtime; the SIMD ones
+ * have a specialized variant per common rule and a generic one.
+ */
+static life_kernel_fn life_kernel_variant(int kernel) {
+#ifdef LIFE_X86
+    if (kernel == LIFE_KERNEL_SSE2 || kernel == LIFE_KERNEL_AVX2) {
+        size_t v = 0;
+        while (v < LIFE_RULE_VARIANTS && rule_variants[v] != life_rule) v++;
+        return (kernel == LIFE_KERNEL_SSE2 ? sse2_variants : avx2_variants)[v];
+    }
+#endif
+    return kernel_fns[kernel];
+}
+
+/**
+ * @brief Check (via CPUID) whether this host can run a given kernel.
+ */
+static int life_kernel_supported(int kernel) {
+#ifdef LIFE_X86
+    __builtin_cpu_init();
+    if (kernel == LIFE_KERNEL_AVX2) return __builtin_cpu_supports("avx2");
+    if (kernel == LIFE_KERNEL_SSE2) return __builtin_cpu_supports("sse2");
+#else
+    if (kernel == LIFE_KERNEL_AVX2 || kernel == LIFE_KERNEL_SSE2) return 0;
+#endif
+    return kernel == LIFE_KERNEL_SCALAR || kernel == LIFE_KERNEL_COLSUM || kernel == LIFE_KERNEL_LUT;
+}
+
+const char* life_kernel_name(int kernel) {
+    if (kernel < 0 || kernel >= LIFE_KERNEL_COUNT) return NULL;
+    return kernel_names[kernel];
+}
+
+int life_select_kernel(int kernel) {
+    if (kernel == LIFE_KERNEL_AUTO) {
+        // Widest kernel first (scalar is always supported)
+        for (size_t k = 0; k < sizeof(kernel_auto_order) / sizeof(kernel_auto_order[0]); k++) {
+            kernel = kernel_auto_order[k];
+            if (life_kernel_supported(kernel)) break;
+        }
+    }
+    if (kernel <= LIFE_KERNEL_AUTO || kernel >= LIFE_KERNEL_COUNT) return -1;
+    if (!life_kernel_supported(kernel)) return -1;
+
+    // Table-driven kernel: build its table now, outside any timed region
+    if (kernel == LIFE_KERNEL_LUT) life_lut_init();
+
+    active_id     = kernel;
+    active_kernel = life_kernel_variant(kernel);
+    return kernel;
+}
+
+void life_kernel_release(void) {
+    free(colsum_row);
+    colsum_row  = NULL;
+    colsum_size = 0;
+}
+
+void life_set_rule(unsigned rule) {
+    life_rule = rule;
+
+    // Switch an already selected kernel to the variant of the new rule
+    if (active_kernel) {
+        if (active_id == LIFE_KERNEL_LUT) life_lut_init();
+        active_kernel = life_kernel_variant(active_id);
+    }
+}
+
+void life_step(const char *current, char *next, int rows, int cols, int pitch,
+               life_stats_t *stats) {
+    if (!active_kernel) life_select_kernel(LIFE_KERNEL_AUTO);
+    active_kernel(current, next, rows, cols, pitch, stats);
+}
+
+void life_step_inplace(char *buf, char *ring, int rows, int cols, int pitch, life_stats_t *stats) {
+    int band = LIFE_INPLACE_ROWS;
+
+    // Ring rows 0, 1: original rows i-1, i of the first band (ghost row 0 and row 1)
+    memcpy(ring, buf, (size_t)2 * pitch);
+
+    long alive = 0, births = 0, deaths = 0;
+    for (int i = 1; i <= rows; i += band) {
+        int h = rows - i + 1 < band ? rows - i + 1 : band;
+
+        // Rows i+1 .. i+h are still original in buf (row i+h is the one below the band)
+        memcpy(ring + 2 * pitch, buf + (size_t)(i + 1) * pitch, (size_t)h * pitch);
+
+        // The window ring[0 .. h+1] holds original rows i-1 .. i+h: write rows i .. i+h-1
+        life_stats_t band_stats;
+        life_step(ring, buf + (size_t)(i - 1) * pitch, h, cols, pitch, &band_stats);
+        alive  += band_stats.alive;
+        births += band_stats.births;
+        deaths += band_stats.deaths;
+
+        // Original rows i+h-1, i+h are the top of the next window
+        memmove(ring, ring + (size_t)h * pitch, (size_t)2 * pitch);
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+int life_packed_words(int cols) {
+    return (cols + 63) / 64;
+}
+
+uint64_t* life_pack(const char *board, int rows, int cols) {
+    int words = life_packed_words(cols);
+    uint64_t *packed = calloc((size_t)rows * words, sizeof(uint64_t));
+    if (!packed) return NULL;
+
+    for (int i = 0; i < rows; i++) {
+        uint64_t *row = packed + (size_t)i * words;
+        for (int j = 0; j < cols; j++) {
+            row[j / 64] |= (uint64_t)(board[(size_t)i * cols + j] & 1) << (j % 64);
+        }
+    }
+    return packed;
+}
+
+void life_destroy_packed(uint64_t *board) {
+    if (board) {
+        free(board);
+    }
+}
+
+long life_count_packed(const uint64_t *board, size_t nwords) {
+    long count = 0;
+    for (size_t i = 0; i < nwords; i++) {
+        count += __builtin_popcountll(board[i]);
+    }
+    return count;
+}
+
+/**
+ * @brief Next state of 64 packed cells under any rule.
+ *
+ * The count is s0 + 2*(a1 + b1 + c1 + k0): the four twos-bits are summed
+ * into three more bit-planes, then the cells whose 4-bit count is in the B
+ * list (dead) or in the S list (alive) are set.
+ */
+static inline uint64_t life_packed_rule(unsigned rule, uint64_t s0, uint64_t a1, uint64_t b1,
+                                        uint64_t c1, uint64_t k0, uint64_t alive) {
+    uint64_t h0 = a1 ^ b1, h1 = a1 & b1;
+    uint64_t g0 = c1 ^ k0, g1 = c1 & k0;
+    uint64_t n1 = h0 ^ g0, carry = h0 & g0;
+    uint64_t n2 = h1 ^ g1 ^ carry;
+    uint64_t n3 = (h1 & g1) | (carry & (h1 ^ g1));
+    uint64_t planes[4] = { s0, n1, n2, n3 };
+
+    uint64_t born = 0, keep = 0;
+    for (int n = 0; n <= 8; n++) {
+        if (!((rule >> n) & 1) && !((rule >> (9 + n)) & 1)) continue;
+        uint64_t eq = ~UINT64_C(0);
+        for (int b = 0; b < 4; b++) {
+            eq &= ((n >> b) & 1) ? planes[b] : ~planes[b];
+        }
+        if ((rule >> n) & 1)       born |= eq;
+        if ((rule >> (9 + n)) & 1) keep |= eq;
+    }
+    return (born & ~alive) | (keep & alive);
+}
+
+void life_step_packed(const uint64_t *current, uint64_t *next, int rows, int cols,
+                      life_stats_t *stats) {
+    const unsigned rule = life_rule;
+    int words  = life_packed_words(cols);
+    int stride = words + 2;
+
+    // Mask of the bits actually used in the last real word of each row
+    uint64_t last_mask = (cols % 64) ? ((UINT64_C(1) << (cols % 64)) - 1) : ~UINT64_C(0);
+
+    long alive = 0, births = 0, deaths = 0;
+
+    for (int i = 1; i <= rows; i++) {
+        const uint64_t *up  = current + (size_t)(i - 1) * stride;
+        const uint64_t *mid = current + (size_t)i * stride;
+        const uint64_t *dn  = current + (size_t)(i + 1) * stride;
+        uint64_t *out       = next + (size_t)i * stride;
+
+        for (int w = 1; w <= words; w++) {
+            // West/east neighbors: shift by one column, carrying the edge bit
+            // in from the adjacent word (ghost words are 0)
+            uint64_t uw = (up[w]  << 1) | (up[w - 1]  >> 63);
+            uint64_t ue = (up[w]  >> 1) | (up[w + 1]  << 63);
+            uint64_t mw = (mid[w] << 1) | (mid[w - 1] >> 63);
+            uint64_t me = (mid[w] >> 1) | (mid[w + 1] << 63);
+            uint64_t dw = (dn[w]  << 1) | (dn[w - 1]  >> 63);
+            uint64_t de = (dn[w]  >> 1) | (dn[w + 1]  << 63);
+
+            // Per-row sums as two bit-planes (full adder above/below, half adder in the middle)
+            uint64_t a0 = uw ^ up[w] ^ ue;
+            uint64_t a1 = (uw & up[w]) | (ue & (uw ^ up[w]));
+            uint64_t b0 = mw ^ me;
+            uint64_t b1 = mw & me;
+            uint64_t c0 = dw ^ dn[w] ^ de;
+            uint64_t c1 = (dw & dn[w]) | (de & (dw ^ dn[w]));
+
+            // Add the ones-planes: bit0 of the total plus a carry into the twos
+            uint64_t s0 = a0 ^ b0 ^ c0;
+            uint64_t k0 = (a0 & b0) | (c0 & (a0 ^ b0));
+
+            uint64_t state;
+            if (rule == LIFE_RULE_LIFE) {
+                // count is 2 or 3 iff exactly one of the four twos-bits is set
+                uint64_t odd   = a1 ^ b1 ^ c1 ^ k0;
+                uint64_t pairs = (a1 & b1) | (c1 & k0);
+                uint64_t twos  = odd & ~pairs;
+
+                // Alive next iff count == 3, or count == 2 and alive now
+                state = twos & (s0 | mid[w]);
             } else {
-                if (alive_neighbors == 3) {
-                    new_state = 1;  // reproduction
+                state = life_packed_rule(rule, s0, a1, b1, c1, k0, mid[w]);
+            }
+
+            // Keep the unused bits of the last word dead
+            state &= (w == words ? last_mask : ~UINT64_C(0));
+            out[w] = state;
+
+            // Same sweep: population and transitions (popcount per word)
+            alive  += __builtin_popcountll(state);
+            births += __builtin_popcountll(state & ~mid[w]);
+            deaths += __builtin_popcountll(mid[w] & ~state);
+        }
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+uint64_t* life_spread(const char *board, int rows, int cols) {
+    uint64_t *spread = malloc((size_t)rows * cols * sizeof(uint64_t));
+    if (!spread) return NULL;
+
+    for (size_t n = 0; n < (size_t)rows * cols; n++) {
+        spread[n] = (board[n] & 1) ? ~UINT64_C(0) : 0;
+    }
+    return spread;
+}
+
+/**
+ * @brief Number of bit-planes of the per-lane counters of life_step_ensemble().
+ *
+ * The planes hold counts below 2^16, so they are unpacked into the long
+ * counters at the latest every 2^16 - 1 added words.
+ */
+#define LIFE_LANE_PLANES 16
+
+/**
+ * @brief Words added to the 4-plane counters of a group before they go into the wide planes.
+ */
+#define LIFE_LANE_GROUP 15
+
+/**
+ * @brief Add the unpacked bit-planes to the per-lane counts and clear them.
+ */
+static void life_lanes_flush(uint64_t *plane, long *alive) {
+    for (int b = 0; b < LIFE_LANE_PLANES; b++) {
+        for (int k = 0; plane[b] && k < LIFE_LANES; k++) {
+            alive[k] += (long)((plane[b] >> k) & 1) << b;
+        }
+        plane[b] = 0;
+    }
+}
+
+/**
+ * @brief Add a 4-plane bit-sliced number (one 0..15 count per lane) to the wide planes.
+ */
+static inline void life_lanes_add(uint64_t *plane, uint64_t p0, uint64_t p1, uint64_t p2, uint64_t p3) {
+    uint64_t add[4] = { p0, p1, p2, p3 };
+    uint64_t carry = 0;
+    for (int b = 0; b < LIFE_LANE_PLANES; b++) {
+        uint64_t x = b < 4 ? add[b] : 0;
+        if (b >= 4 && !carry) break;
+        uint64_t sum = plane[b] ^ x ^ carry;
+        carry    = (plane[b] & x) | (carry & (plane[b] ^ x));
+        plane[b] = sum;
+    }
+}
+
+void life_step_ensemble(const uint64_t *current, uint64_t *next, int rows, int cols, uint64_t active,
+                        life_lanes_t *lanes) {
+    const unsigned rule = life_rule;
+    const int stride = cols + 2;
+    const long groups_per_flush = ((1L << LIFE_LANE_PLANES) - 1) / LIFE_LANE_GROUP;
+    uint64_t plane[LIFE_LANE_PLANES] = { 0 };
+    uint64_t changed = 0;
+    long groups = 0;
+
+    memset(lanes->alive, 0, sizeof(lanes->alive));
+
+    for (int i = 1; i <= rows; i++) {
+        const uint64_t *up  = current + (size_t)(i - 1) * stride;
+        const uint64_t *mid = current + (size_t)i * stride;
+        const uint64_t *dn  = current + (size_t)(i + 1) * stride;
+        uint64_t *out       = next + (size_t)i * stride;
+
+        for (int j0 = 1; j0 <= cols; j0 += LIFE_LANE_GROUP) {
+            int j1 = j0 + LIFE_LANE_GROUP <= cols + 1 ? j0 + LIFE_LANE_GROUP : cols + 1;
+
+            // 4-bit counters of the group, one per lane (at most 15 words: no overflow)
+            uint64_t p0 = 0, p1 = 0, p2 = 0, p3 = 0;
+
+            for (int j = j0; j < j1; j++) {
+                // Per-row sums as two bit-planes, as in life_step_packed() with the
+                // west/east neighbors being the adjacent words instead of shifts
+                uint64_t a0 = up[j - 1] ^ up[j] ^ up[j + 1];
+                uint64_t a1 = (up[j - 1] & up[j]) | (up[j + 1] & (up[j - 1] ^ up[j]));
+                uint64_t b0 = mid[j - 1] ^ mid[j + 1];
+                uint64_t b1 = mid[j - 1] & mid[j + 1];
+                uint64_t c0 = dn[j - 1] ^ dn[j] ^ dn[j + 1];
+                uint64_t c1 = (dn[j - 1] & dn[j]) | (dn[j + 1] & (dn[j - 1] ^ dn[j]));
+
+                uint64_t s0 = a0 ^ b0 ^ c0;
+                uint64_t k0 = (a0 & b0) | (c0 & (a0 ^ b0));
+
+                uint64_t state;
+                if (rule == LIFE_RULE_LIFE) {
+                    uint64_t odd   = a1 ^ b1 ^ c1 ^ k0;
+                    uint64_t pairs = (a1 & b1) | (c1 & k0);
+                    state = odd & ~pairs & (s0 | mid[j]);
                 } else {
-                    new_state = 0;  // remains dead
+                    state = life_packed_rule(rule, s0, a1, b1, c1, k0, mid[j]);
                 }
+
+                // Frozen lanes keep their state
+                state   = (state & active) | (mid[j] & ~active);
+                out[j]  = state;
+                changed |= state ^ mid[j];
+
+                // Bit-sliced increment of the count of every lane whose cell is alive
+                uint64_t c = state, t;
+                t = p0 & c; p0 ^= c; c = t;
+                t = p1 & c; p1 ^= c; c = t;
+                t = p2 & c; p2 ^= c; c = t;
+                p3 ^= c;
+            }
+
+            life_lanes_add(plane, p0, p1, p2, p3);
+            if (++groups == groups_per_flush) {
+                life_lanes_flush(plane, lanes->alive);
+                groups = 0;
             }
-            next[i * cols + j] = new_state;
         }
     }
+
+    life_lanes_flush(plane, lanes->alive);
+    lanes->changed = changed;
 }
 
 /* ********************************************************************************************* */
@@ -0,0 +1,239 @@
+//    _____      _     ___                             __                       
+//   |_   _|    (_)  .' ..]                           [  |                      
+//     | |      __  _| |_  .---.  .---.  ,--.   .---.  | |--.  .---.     .---.  
+//     | |   _ [  |'-| |-'/ /__\\/ /'`\]`'_\ : / /'`\] | .-. |/ /__\\   / /'`\] 
+//    _| |__/ | | |  | |  | \__.,| \__. // | |,| \__.  | | | || \__., _ | \__.  
+//   |________|[___][___]  '.__.''.___.'\'-;__/'.___.'[___]|__]'.__.'(_)'.___.' 
+//                                                                              
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "life.h"
+#include "lifecache.h"
+
+/* ********************************************************************************************* */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define MEMO_LITTLE_ENDIAN 1
+#endif
+
+// Eight 0/1 bytes of a row as uint64 values, one per 8-bit pattern (byte j = bit j)
+static uint64_t memo_spread[256];
+
+life_memo_t* life_memo_create(int capacity) {
+    for (int v = 0; v < 256; v++) {
+        uint64_t bytes = 0;
+        for (int j = 0; j < 8; j++) bytes |= (uint64_t)((v >> j) & 1) << (8 * j);
+        memo_spread[v] = bytes;
+    }
+
+    life_memo_t *memo = calloc(1, sizeof(life_memo_t));
+    if (!memo) return NULL;
+
+    int buckets = 1;
+    while (buckets < capacity) buckets <<= 1;
+
+    memo->capacity = capacity;
+    memo->mask     = buckets - 1;
+    memo->newest   = memo->oldest = -1;
+    memo->bucket   = malloc((size_t)buckets * sizeof(int));
+    memo->key      = malloc((size_t)2 * capacity * sizeof(uint64_t));
+    memo->value    = malloc((size_t)capacity * sizeof(uint64_t));
+    memo->chain    = malloc((size_t)capacity * sizeof(int));
+    memo->newer    = malloc((size_t)capacity * sizeof(int));
+    memo->older    = malloc((size_t)capacity * sizeof(int));
+    if (!memo->bucket || !memo->key || !memo->value || !memo->chain || !memo->newer || !memo->older) {
+        life_memo_destroy(memo);
+        return NULL;
+    }
+
+    // All bytes 0xFF: every bucket starts empty (-1)
+    memset(memo->bucket, 0xFF, (size_t)buckets * sizeof(int));
+    return memo;
+}
+
+void life_memo_destroy(life_memo_t *memo) {
+    if (memo) {
+        free(memo->bucket);
+        free(memo->key);
+        free(memo->value);
+        free(memo->chain);
+        free(memo->newer);
+        free(memo->older);
+        free(memo);
+    }
+}
+
+/**
+ * @brief Bucket of a 100-bit key (multiplicative mixing of both words).
+ */
+static inline int memo_hash(const life_memo_t *memo, uint64_t k0, uint64_t k1) {
+    uint64_t h = (k0 ^ (k1 * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL;
+    return (int)(h >> 32) & memo->mask;
+}
+
+/**
+ * @brief Remove entry e from the recency list.
+ */
+static inline void memo_unlink(life_memo_t *memo, int e) {
+    if (memo->newer[e] >= 0) memo->older[memo->newer[e]] = memo->older[e];
+    else                     memo->newest = memo->older[e];
+    if (memo->older[e] >= 0) memo->newer[memo->older[e]] = memo->newer[e];
+    else                     memo->oldest = memo->newer[e];
+}
+
+/**
+ * @brief Put entry e at the most recently used end of the recency list.
+ */
+static inline void memo_push(life_memo_t *memo, int e) {
+    memo->newer[e] = -1;
+    memo->older[e] = memo->newest;
+    if (memo->newest >= 0) memo->newer[memo->newest] = e;
+    memo->newest = e;
+    if (memo->oldest < 0) memo->oldest = e;
+}
+
+/**
+ * @brief Next 8×8 tile of a 10×10 block given as ten 10-bit rows.
+ *
+ * Bit c of block[r] is column c of the block; bit 8*i + j of the result is
+ * the next state of block cell (i+1, j+1). Only used on cache misses.
+ */
+static uint64_t memo_compute(const uint16_t block[10]) {
+    const unsigned rule = life_get_rule();
+    uint64_t tile = 0;
+    for (int i = 0; i < LIFE_MEMO_TILE; i++) {
+        for (int j = 0; j < LIFE_MEMO_TILE; j++) {
+            int alive_neighbors = __builtin_popcount((block[i] >> j) & 7u) +
+                                  __builtin_popcount((block[i + 1] >> j) & 7u) +
+                                  __builtin_popcount((block[i + 2] >> j) & 7u);
+            int is_alive = (block[i + 1] >> (j + 1)) & 1;
+            alive_neighbors -= is_alive;
+
+            tile |= (uint64_t)LIFE_RULE_NEXT(rule, is_alive, alive_neighbors) << (8 * i + j);
+        }
+    }
+    return tile;
+}
+
+/**
+ * @brief Pack up to 10 consecutive 0/1 bytes into bits (bit c = byte c).
+ */
+static inline uint16_t memo_gather(const char *src, int n) {
+#ifdef MEMO_LITTLE_ENDIAN
+    if (n == 10) {
+        // Eight bytes at once: the multiply moves byte k's low bit to bit 56 + k
+        uint64_t x;
+        memcpy(&x, src, sizeof(x));
+        return (uint16_t)(((x * 0x0102040810204080ULL) >> 56) | (src[8] << 8) | (src[9] << 9));
+    }
+#endif
+    uint16_t bits = 0;
+    for (int c = 0; c < n; c++) bits |= (uint16_t)(src[c] << c);
+    return bits;
+}
+
+/**
+ * @brief Next tile of a 10×10 block: cached result, or computed and inserted.
+ */
+static uint64_t memo_lookup(life_memo_t *memo, const uint16_t block[10]) {
+    uint64_t k0 = 0, k1 = 0;
+    for (int r = 0; r < 6; r++)  k0 |= (uint64_t)block[r] << (10 * r);
+    for (int r = 6; r < 10; r++) k1 |= (uint64_t)block[r] << (10 * (r - 6));
+
+    // Empty neighborhood: nothing can be born, no need to touch the cache
+    if ((k0 | k1) == 0) {
+        memo->empty++;
+        return 0;
+    }
+
+    int b = memo_hash(memo, k0, k1);
+    for (int e = memo->bucket[b]; e >= 0; e = memo->chain[e]) {
+        if (memo->key[2 * e] == k0 && memo->key[2 * e + 1] == k1) {
+            memo->hits++;
+            memo_unlink(memo, e);
+            memo_push(memo, e);
+            return memo->value[e];
+        }
+    }
+
+    memo->misses++;
+    uint64_t tile = memo_compute(block);
+
+    // Take a free entry, or evict the least recently used one
+    int e;
+    if (memo->count < memo->capacity) {
+        e = memo->count++;
+    } else {
+        e = memo->oldest;
+        memo_unlink(memo, e);
+
+        int old = memo_hash(memo, memo->key[2 * e], memo->key[2 * e + 1]);
+        int *link = &memo->bucket[old];
+        while (*link != e) link = &memo->chain[*link];
+        *link = memo->chain[e];
+    }
+
+    memo->key[2 * e]     = k0;
+    memo->key[2 * e + 1] = k1;
+    memo->value[e]       = tile;
+    memo->chain[e]       = memo->bucket[b];
+    memo->bucket[b]      = e;
+    memo_push(memo, e);
+    return tile;
+}
+
+void life_step_memo(life_memo_t *memo, const char *current, char *next, int rows, int cols,
+                    int pitch, life_stats_t *stats) {
+    long alive = 0, births = 0, deaths = 0;
+
+    for (int r0 = 0; r0 < rows; r0 += LIFE_MEMO_TILE) {
+        int vr = rows - r0 < LIFE_MEMO_TILE ? rows - r0 : LIFE_MEMO_TILE;
+
+        for (int c0 = 0; c0 < cols; c0 += LIFE_MEMO_TILE) {
+            int vc = cols - c0 < LIFE_MEMO_TILE ? cols - c0 : LIFE_MEMO_TILE;
+
+            // Gather the 10×10 block: buffer rows r0..r0+9, offsets c0..c0+9
+            // (ghost rows/columns included, anything past them reads as dead)
+            int br = rows + 2 - r0 < 10 ? rows + 2 - r0 : 10;
+            int bc = cols + 2 - c0 < 10 ? cols + 2 - c0 : 10;
+            uint16_t block[10] = { 0 };
+            for (int r = 0; r < br; r++) {
+                block[r] = memo_gather(current + (size_t)(r0 + r) * pitch + c0, bc);
+            }
+
+            uint64_t tile = memo_lookup(memo, block);
+
+            // Valid cells only: the tile may hang over the last row/column
+            uint64_t row_mask = (vc == 8) ? 0xFFULL : ((1ULL << vc) - 1);
+            uint64_t valid = 0, now = 0;
+            for (int i = 0; i < vr; i++) {
+                valid |= row_mask << (8 * i);
+                now   |= (uint64_t)((block[i + 1] >> 1) & 0xFF) << (8 * i);
+            }
+            tile &= valid;
+            now  &= valid;
+
+            alive  += __builtin_popcountll(tile);
+            births += __builtin_popcountll(tile & ~now);
+            deaths += __builtin_popcountll(now & ~tile);
+
+            for (int i = 0; i < vr; i++) {
+                char *dst = next + (size_t)(r0 + i + 1) * pitch + c0 + 1;
+                uint64_t bytes = memo_spread[(tile >> (8 * i)) & 0xFF];
+#ifdef MEMO_LITTLE_ENDIAN
+                if (vc == LIFE_MEMO_TILE) {
+                    memcpy(dst, &bytes, sizeof(bytes));
+                    continue;
+                }
+#endif
+                for (int j = 0; j < vc; j++) dst[j] = (char)(bytes >> (8 * j));
+            }
+        }
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/* ********************************************************************************************* */
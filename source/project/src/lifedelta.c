@@ -0,0 +1,176 @@
+//    _____      _     ___             __         __   _                    
+//   |_   _|    (_)  .' ..]           |  ]       [  | / |_                  
+//     | |      __  _| |_  .---.   .--.| | .---.  | |`| |-',--.      .---.  
+//     | |   _ [  |'-| |-'/ /__\\/ /'`\' |/ /__\\ | | | | `'_\ :    / /'`\] 
+//    _| |__/ | | |  | |  | \__.,| \__/  || \__., | | | |,// | |, _ | \__.  
+//   |________|[___][___]  '.__.' '.__.;__]'.__.'[___]\__/\'-;__/(_)'.___.' 
+//                                                                          
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "lifedelta.h"
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Make room for `needed` entries in a cell index list (grows geometrically).
+ */
+static int delta_reserve(size_t **list, size_t *capacity, size_t needed) {
+    if (needed <= *capacity) return 0;
+
+    size_t grown = *capacity ? *capacity : 1024;
+    while (grown < needed) grown *= 2;
+    size_t *p = realloc(*list, grown * sizeof(size_t));
+    if (!p) return -1;
+    *list     = p;
+    *capacity = grown;
+    return 0;
+}
+
+life_delta_t* life_delta_create(const char *buf, int rows, int cols, int pitch) {
+    life_delta_t *delta = calloc(1, sizeof(life_delta_t));
+    if (!delta) return NULL;
+
+    size_t cells = (size_t)rows * cols;
+    delta->rows   = rows;
+    delta->cols   = cols;
+    delta->cell   = calloc(cells, 1);
+    delta->count  = calloc(cells, 1);
+    delta->queued = calloc(cells, 1);
+    for (int g = 0; g < 2; g++) {
+        delta->ghost[g]       = calloc((size_t)cols, 1);
+        delta->edge_flips[g]  = malloc((size_t)cols * sizeof(int));
+        delta->ghost_flips[g] = malloc((size_t)cols * sizeof(int));
+    }
+    if (!delta->cell || !delta->count || !delta->queued ||
+        !delta->ghost[0] || !delta->edge_flips[0] || !delta->ghost_flips[0] ||
+        !delta->ghost[1] || !delta->edge_flips[1] || !delta->ghost_flips[1]) {
+        life_delta_destroy(delta);
+        return NULL;
+    }
+
+    // Every alive cell enters as a flip from the all-dead slab
+    for (int i = 0; i < rows; i++) {
+        const char *row = buf + (size_t)(i + 1) * pitch + 1;
+        for (int j = 0; j < cols; j++) {
+            if (!row[j]) continue;
+            if (delta_reserve(&delta->flips, &delta->flip_capacity, delta->flip_count + 1) != 0) {
+                life_delta_destroy(delta);
+                return NULL;
+            }
+            delta->cell[(size_t)i * cols + j] = 1;
+            delta->flips[delta->flip_count++] = (size_t)i * cols + j;
+            if (i == 0)        delta->edge_flips[0][delta->edge_flip_count[0]++] = j;
+            if (i == rows - 1) delta->edge_flips[1][delta->edge_flip_count[1]++] = j;
+            delta->alive++;
+        }
+    }
+    return delta;
+}
+
+void life_delta_destroy(life_delta_t *delta) {
+    if (delta) {
+        free(delta->cell);
+        free(delta->count);
+        free(delta->queued);
+        for (int g = 0; g < 2; g++) {
+            free(delta->ghost[g]);
+            free(delta->edge_flips[g]);
+            free(delta->ghost_flips[g]);
+        }
+        free(delta->flips);
+        free(delta->candidates);
+        free(delta);
+    }
+}
+
+/* ********************************************************************************************* */
+
+int life_step_delta(life_delta_t *delta, life_stats_t *stats) {
+    const unsigned rule = life_get_rule();
+    int rows = delta->rows, cols = delta->cols;
+    unsigned char *cell   = delta->cell;
+    unsigned char *count  = delta->count;
+    unsigned char *queued = delta->queued;
+
+    // Every flip queues at most 9 cells, every ghost flip 3
+    size_t bound = 9 * delta->flip_count + 3 * (size_t)(delta->ghost_flip_count[0] + delta->ghost_flip_count[1]);
+    if (bound > (size_t)rows * cols) bound = (size_t)rows * cols;
+    if (delta_reserve(&delta->candidates, &delta->candidate_capacity, bound) != 0) return -1;
+    size_t *candidates = delta->candidates;
+    size_t n = 0;
+
+#define DELTA_QUEUE(idx) do { if (!queued[idx]) { queued[idx] = 1; candidates[n++] = (idx); } } while (0)
+
+    // 1. Own flips: adjust the counts of the 8 neighbors (new state gives the sign)
+    for (size_t f = 0; f < delta->flip_count; f++) {
+        size_t idx = delta->flips[f];
+        int i = (int)(idx / cols), j = (int)(idx % cols);
+        unsigned char d = cell[idx] ? 1 : (unsigned char)-1;
+
+        DELTA_QUEUE(idx);
+        for (int di = -1; di <= 1; di++) {
+            int r = i + di;
+            if (r < 0 || r >= rows) continue;
+            for (int dj = -1; dj <= 1; dj++) {
+                int c = j + dj;
+                if ((di == 0 && dj == 0) || c < 0 || c >= cols) continue;
+                size_t k = (size_t)r * cols + c;
+                count[k] += d;
+                DELTA_QUEUE(k);
+            }
+        }
+    }
+
+    // 2. Ghost flips: the rows above/below touch only the first/last real row
+    for (int g = 0; g < 2; g++) {
+        int r = g ? rows - 1 : 0;
+        for (int f = 0; f < delta->ghost_flip_count[g]; f++) {
+            int j = delta->ghost_flips[g][f];
+            delta->ghost[g][j] ^= 1;
+            unsigned char d = delta->ghost[g][j] ? 1 : (unsigned char)-1;
+            for (int c = j - 1; c <= j + 1; c++) {
+                if (c < 0 || c >= cols) continue;
+                size_t k = (size_t)r * cols + c;
+                count[k] += d;
+                DELTA_QUEUE(k);
+            }
+        }
+        delta->ghost_flip_count[g] = 0;
+    }
+
+#undef DELTA_QUEUE
+
+    // 3. Evaluate the candidates against the complete counts; flips reuse the list in place
+    size_t flips = 0;
+    for (size_t c = 0; c < n; c++) {
+        size_t idx = candidates[c];
+        queued[idx] = 0;
+        int is_alive = (int)LIFE_RULE_NEXT(rule, cell[idx], count[idx]);
+        if (is_alive != cell[idx]) candidates[flips++] = idx;
+    }
+
+    // 4. Apply the flips only now, so that every cell saw the same generation
+    if (delta_reserve(&delta->flips, &delta->flip_capacity, flips) != 0) return -1;
+    long births = 0, deaths = 0;
+    delta->edge_flip_count[0] = delta->edge_flip_count[1] = 0;
+    for (size_t f = 0; f < flips; f++) {
+        size_t idx = candidates[f];
+        cell[idx] ^= 1;
+        births += cell[idx];
+        deaths += !cell[idx];
+        delta->flips[f] = idx;
+
+        int i = (int)(idx / cols);
+        if (i == 0)        delta->edge_flips[0][delta->edge_flip_count[0]++] = (int)(idx % cols);
+        if (i == rows - 1) delta->edge_flips[1][delta->edge_flip_count[1]++] = (int)(idx % cols);
+    }
+    delta->flip_count = flips;
+    delta->alive += births - deaths;
+
+    life_stats_set(stats, delta->alive, births, deaths);
+    return 0;
+}
+
+/* ********************************************************************************************* */
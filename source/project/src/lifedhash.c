@@ -0,0 +1,1057 @@
+//    _____      _     ___             __   __                     __                 
+//   |_   _|    (_)  .' ..]           |  ] [  |                   [  |                
+//     | |      __  _| |_  .---.   .--.| |  | |--.   ,--.   .--.   | |--.      .---.  
+//     | |   _ [  |'-| |-'/ /__\\/ /'`\' |  | .-. | `'_\ : ( (`\]  | .-. |    / /'`\] 
+//    _| |__/ | | |  | |  | \__.,| \__/  |  | | | | // | |, `'.'.  | | | |  _ | \__.  
+//   |________|[___][___]  '.__.' '.__.;__][___]|__]\'-;__/[\__) )[___]|__](_)'.___.' 
+//                                                                                    
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lifedhash.h"
+#include "mpix.h"
+
+/* ********************************************************************************************* */
+
+#define DHASH_LIVE 1    // slot holds a node of the table
+#define DHASH_MARK 2    // reached by the current collection
+
+#define DHASH_MIN_CAPACITY ((size_t)1 << 12)
+#define DHASH_NO_SLOT      UINT32_MAX   // end of a hash chain, free list or waiter list
+#define DHASH_BROADCAST    (-1)         // waiter rank: send the value to every rank
+
+// Node names (see life_dnode_t)
+#define DHASH_INLINE     ((life_dnode_t)1 << 63)
+#define DHASH_EMPTY      ((life_dnode_t)1 << 62)
+#define DHASH_INDEX_BITS 36
+#define DHASH_OWNER_BITS 20
+#define DHASH_LEVEL_SHIFT 56
+
+// Message kinds: requests, then replies
+enum {
+    MSG_FETCH = 1,  // children of a node → MSG_CHILDREN
+    MSG_JOIN,       // node with the given children → MSG_VALUE
+    MSG_RESULT,     // advanced center of a node → MSG_VALUE (possibly supersteps later)
+    MSG_POP,        // population of a node → MSG_VALUE (possibly supersteps later)
+    MSG_MARK,       // node reached by a collection (no reply)
+    MSG_CHILDREN,
+    MSG_VALUE,
+    MSG_DONE        // value of the whole computation, sent to every rank
+};
+
+// Task states: the value (children, sub-squares, ...) the task is collecting
+enum { TASK_START, TASK_GC, TASK_GGC, TASK_SUB, TASK_R, TASK_Q, TASK_S, TASK_OUT };
+
+#define MSG_WORDS ((int)(sizeof(life_dhash_msg_t) / sizeof(uint64_t)))
+
+#define DHASH_OP(kind, target, slot) \
+    ((uint64_t)(kind) | (uint64_t)(slot) << 8 | (uint64_t)(target) << 16)
+
+static inline life_dnode_t dhash_leaf(unsigned bits) {
+    return DHASH_INLINE | bits;
+}
+
+static inline life_dnode_t dhash_empty(int level) {
+    return level == 2 ? dhash_leaf(0) : (DHASH_INLINE | DHASH_EMPTY | (life_dnode_t)level);
+}
+
+static inline int dhash_is_inline(life_dnode_t n) {
+    return (n & DHASH_INLINE) != 0;
+}
+
+static inline int dhash_is_empty(life_dnode_t n) {
+    return n == dhash_leaf(0) || (n & (DHASH_INLINE | DHASH_EMPTY)) == (DHASH_INLINE | DHASH_EMPTY);
+}
+
+static inline int dhash_level(life_dnode_t n) {
+    if (n & DHASH_INLINE) return (n & DHASH_EMPTY) ? (int)(n & 63) : 2;
+    return (int)(n >> DHASH_LEVEL_SHIFT) & 63;
+}
+
+static inline int dhash_owner(life_dnode_t n) {
+    return (int)(n >> DHASH_INDEX_BITS) & ((1 << DHASH_OWNER_BITS) - 1);
+}
+
+static inline size_t dhash_index(life_dnode_t n) {
+    return (size_t)(n & (((life_dnode_t)1 << DHASH_INDEX_BITS) - 1));
+}
+
+static inline life_dnode_t dhash_name(int level, int owner, size_t index) {
+    return (life_dnode_t)level << DHASH_LEVEL_SHIFT | (life_dnode_t)owner << DHASH_INDEX_BITS | index;
+}
+
+static inline int dhash_all_empty(const life_dnode_t c[4]) {
+    return dhash_is_empty(c[0]) && dhash_is_empty(c[1]) && dhash_is_empty(c[2]) && dhash_is_empty(c[3]);
+}
+
+static inline uint64_t dhash_key(const life_dnode_t c[4]) {
+    uint64_t h = c[0] * 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 32) ^ c[1]) * 0xC2B2AE3D27D4EB4FULL;
+    h = (h ^ (h >> 32) ^ c[2]) * 0x165667B19E3779F9ULL;
+    h = (h ^ (h >> 32) ^ c[3]) * 0x9E3779B97F4A7C15ULL;
+    return h ^ (h >> 29);
+}
+
+/**
+ * @brief Rank storing the node with this key (high bits; the low bits pick the bucket).
+ */
+static inline int dhash_home(const life_dhash_t *hash, uint64_t key) {
+    return (int)((key >> 40) % (uint64_t)hash->size);
+}
+
+/**
+ * @brief Nodes advance at full speed (2^(level-2) generations) up to level step_log + 2.
+ */
+static inline int dhash_full_speed(const life_dhash_t *hash, int level) {
+    return level <= hash->step_log + 2;
+}
+
+/**
+ * @brief Grow a bookkeeping array to hold `needed` elements (aborts when out of memory).
+ */
+static void* dhash_reserve(const life_dhash_t *hash, void *array, size_t *capacity,
+                           size_t needed, size_t elem_size) {
+    if (needed <= *capacity) return array;
+
+    size_t grown = *capacity ? *capacity : 64;
+    while (grown < needed) grown *= 2;
+    void *p = realloc(array, grown * elem_size);
+    if (!p) {
+        fprintf(stderr, "Error: realloc failed in lifedhash on rank %d\n", hash->rank);
+        MPI_Abort(hash->comm, EXIT_FAILURE);
+    }
+    *capacity = grown;
+    return p;
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Double the local node table and rebuild the hash chains (bounded by max_nodes).
+ */
+static int dhash_grow(life_dhash_t *hash) {
+    size_t capacity = hash->capacity * 2;
+    if (capacity > hash->max_nodes) return -1;
+
+    life_dhash_node_t *nodes = realloc(hash->nodes, capacity * sizeof(life_dhash_node_t));
+    if (!nodes) return -1;
+    hash->nodes = nodes;
+
+    uint32_t *bucket = realloc(hash->bucket, capacity * sizeof(uint32_t));
+    if (!bucket) return -1;
+    hash->bucket   = bucket;
+    hash->capacity = capacity;
+
+    memset(hash->bucket, 0xFF, capacity * sizeof(uint32_t));
+    for (size_t i = 0; i < hash->count; i++) {
+        life_dhash_node_t *node = &hash->nodes[i];
+        if (!(node->flags & DHASH_LIVE)) continue;
+        size_t b = dhash_key(node->child) & (capacity - 1);
+        node->next = hash->bucket[b];
+        hash->bucket[b] = (uint32_t)i;
+    }
+    return 0;
+}
+
+/**
+ * @brief Canonical node with the given quadrants, stored on this rank (its home).
+ *
+ * If the table is full, sets hash->full and returns the empty node of that
+ * level so the computation can unwind; its result is then discarded.
+ */
+static life_dnode_t dhash_insert(life_dhash_t *hash, const life_dnode_t c[4], uint64_t key) {
+    int level = dhash_level(c[0]) + 1;
+    size_t b = key & (hash->capacity - 1);
+    for (uint32_t n = hash->bucket[b]; n != DHASH_NO_SLOT; n = hash->nodes[n].next) {
+        const life_dhash_node_t *node = &hash->nodes[n];
+        if (node->child[0] == c[0] && node->child[1] == c[1] && node->child[2] == c[2] && node->child[3] == c[3]) {
+            return dhash_name(level, hash->rank, n);
+        }
+    }
+
+    // Take a released slot, then a fresh one, then grow the table
+    uint32_t n;
+    if (hash->free_list != DHASH_NO_SLOT) {
+        n = hash->free_list;
+        hash->free_list = hash->nodes[n].next;
+    } else {
+        if (hash->count == hash->capacity) {
+            if (dhash_grow(hash) != 0) {
+                hash->full = 1;
+                return dhash_empty(level);
+            }
+            b = key & (hash->capacity - 1);
+        }
+        n = (uint32_t)hash->count++;
+    }
+
+    life_dhash_node_t *node = &hash->nodes[n];
+    memcpy(node->child, c, sizeof(node->child));
+    node->result     = LIFE_DHASH_NONE;
+    node->step       = LIFE_DHASH_NONE;
+    node->population = UINT64_MAX;
+    node->task       = DHASH_NO_SLOT;
+    node->flags      = DHASH_LIVE;
+    node->next       = hash->bucket[b];
+    hash->bucket[b]  = n;
+    hash->live++;
+    return dhash_name(level, hash->rank, n);
+}
+
+/**
+ * @brief Children of an inline node or of a node stored here; 0 if n lives elsewhere.
+ */
+static int dhash_children(const life_dhash_t *hash, life_dnode_t n, life_dnode_t out[4]) {
+    if (dhash_is_inline(n)) {
+        // Only empty squares are asked for (leaves are read directly)
+        out[0] = out[1] = out[2] = out[3] = dhash_empty(dhash_level(n) - 1);
+        return 1;
+    }
+    if (dhash_owner(n) != hash->rank) return 0;
+    memcpy(out, hash->nodes[dhash_index(n)].child, 4 * sizeof(life_dnode_t));
+    return 1;
+}
+
+/**
+ * @brief Memoized (or trivial) RESULT / POP value of n; 0 if it has to be computed or asked for.
+ */
+static int dhash_lookup(life_dhash_t *hash, int kind, life_dnode_t n, uint64_t *value) {
+    if (dhash_is_inline(n)) {
+        if (kind == MSG_POP) *value = dhash_is_empty(n) ? 0 : (uint64_t)__builtin_popcount((unsigned)(n & 0xFFFF));
+        else                 *value = dhash_empty(dhash_level(n) - 1);
+        return 1;
+    }
+    if (dhash_owner(n) != hash->rank) return 0;
+
+    life_dhash_node_t *node = &hash->nodes[dhash_index(n)];
+    if (kind == MSG_POP) {
+        // Level 3: the children are leaves
+        if (node->population == UINT64_MAX && dhash_level(n) == 3) {
+            node->population = 0;
+            for (int q = 0; q < 4; q++) node->population += __builtin_popcount((unsigned)(node->child[q] & 0xFFFF));
+        }
+        *value = node->population;
+        return node->population != UINT64_MAX;
+    }
+
+    *value = dhash_full_speed(hash, dhash_level(n)) ? node->result : node->step;
+    return *value != LIFE_DHASH_NONE;
+}
+
+/* ********************************************************************************************* */
+
+static void dhash_mark(life_dhash_t *hash, life_dnode_t n);
+
+/**
+ * @brief Queue a message for `rank` (this rank's own queue is drained before the exchange).
+ */
+static void dhash_post(life_dhash_t *hash, int rank, uint64_t op, const uint64_t *arg, int nargs) {
+    size_t n = hash->outbox_count[rank];
+    hash->outbox[rank] = dhash_reserve(hash, hash->outbox[rank], &hash->outbox_capacity[rank],
+                                       n + 1, sizeof(life_dhash_msg_t));
+    life_dhash_msg_t *msg = &hash->outbox[rank][n];
+    msg->op = op;
+    for (int k = 0; k < 4; k++) msg->arg[k] = k < nargs ? arg[k] : 0;
+    hash->outbox_count[rank] = n + 1;
+}
+
+static void dhash_broadcast(life_dhash_t *hash, uint64_t value) {
+    for (int r = 0; r < hash->size; r++) dhash_post(hash, r, DHASH_OP(MSG_DONE, 0, 0), &value, 1);
+}
+
+static void dhash_ready(life_dhash_t *hash, uint32_t t) {
+    hash->ready = dhash_reserve(hash, hash->ready, &hash->ready_capacity,
+                                hash->ready_count + 1, sizeof(uint32_t));
+    hash->ready[hash->ready_count++] = t;
+}
+
+/**
+ * @brief Register a request for the RESULT / POP value of a node stored here.
+ *
+ * Starts the task computing it unless one is already running; the value is
+ * sent to (rank, target, slot) when the task finishes.
+ */
+static void dhash_wait(life_dhash_t *hash, int kind, life_dnode_t n, int rank, uint32_t target, uint32_t slot) {
+    size_t i = dhash_index(n);
+    uint32_t t = hash->nodes[i].task;
+
+    if (t == DHASH_NO_SLOT) {
+        if (hash->task_free_count > 0) {
+            t = hash->task_free[--hash->task_free_count];
+        } else {
+            size_t capacity = hash->task_capacity;
+            t = (uint32_t)hash->task_count++;
+            hash->tasks = dhash_reserve(hash, hash->tasks, &hash->task_capacity,
+                                        hash->task_count, sizeof(life_dhash_task_t*));
+            hash->task_free = dhash_reserve(hash, hash->task_free, &capacity,
+                                            hash->task_count, sizeof(uint32_t));
+            hash->tasks[t] = malloc(sizeof(life_dhash_task_t));
+            if (!hash->tasks[t]) {
+                fprintf(stderr, "Error: malloc failed in lifedhash on rank %d\n", hash->rank);
+                MPI_Abort(hash->comm, EXIT_FAILURE);
+            }
+        }
+        life_dhash_task_t *task = hash->tasks[t];
+        task->node    = n;
+        task->kind    = kind;
+        task->state   = TASK_START;
+        task->pending = 0;
+        task->waiters = DHASH_NO_SLOT;
+        hash->nodes[i].task = t;
+        dhash_ready(hash, t);
+    }
+
+    uint32_t w;
+    if (hash->waiter_free != DHASH_NO_SLOT) {
+        w = hash->waiter_free;
+        hash->waiter_free = hash->waiters[w].next;
+    } else {
+        w = (uint32_t)hash->waiter_count++;
+        hash->waiters = dhash_reserve(hash, hash->waiters, &hash->waiter_capacity,
+                                      hash->waiter_count, sizeof(life_dhash_waiter_t));
+    }
+    life_dhash_waiter_t *waiter = &hash->waiters[w];
+    waiter->rank   = rank;
+    waiter->target = target;
+    waiter->slot   = slot;
+    waiter->next   = hash->tasks[t]->waiters;
+    hash->tasks[t]->waiters = w;
+}
+
+/**
+ * @brief Store a value awaited by a task, in the array its current state is filling.
+ */
+static void dhash_store(life_dhash_task_t *task, uint32_t slot, const uint64_t *value) {
+    switch (task->state) {
+    case TASK_GC:   // children of child `slot`, into the 4×4 grid
+        for (int c = 0; c < 4; c++) {
+            task->gc[((slot >> 1) * 2 + (c >> 1)) * 4 + (slot & 1) * 2 + (c & 1)] = value[c];
+        }
+        break;
+    case TASK_GGC:  // children of grandchild `slot`, into the 8×8 grid
+        for (int c = 0; c < 4; c++) {
+            task->ggc[((slot >> 2) * 2 + (c >> 1)) * 8 + (slot & 3) * 2 + (c & 1)] = value[c];
+        }
+        break;
+    case TASK_SUB: task->sub[slot] = value[0]; break;
+    case TASK_R:   task->r[slot]   = value[0]; break;
+    case TASK_Q:   task->q[slot]   = value[0]; break;
+    case TASK_S:   task->s[slot]   = value[0]; break;
+    default:       task->out       = value[0]; break;
+    }
+}
+
+/**
+ * @brief A reply arrived for (target, slot): store it and wake the task once complete.
+ */
+static void dhash_deliver(life_dhash_t *hash, uint32_t target, uint32_t slot, const uint64_t *value) {
+    if (hash->batch) {
+        hash->batch[target] = value[0];
+        return;
+    }
+    life_dhash_task_t *task = hash->tasks[target];
+    dhash_store(task, slot, value);
+    if (--task->pending == 0) dhash_ready(hash, target);
+}
+
+/**
+ * @brief Ask for a value on behalf of task t.
+ *
+ * Whatever can be answered on this rank (inline nodes, nodes stored here,
+ * memoized values) is stored right away; the rest is either waited for on
+ * a local task or sent to the owner, and counted in task->pending.
+ */
+static void dhash_request(life_dhash_t *hash, uint32_t t, uint32_t slot, int kind, const life_dnode_t *arg) {
+    life_dhash_task_t *task = hash->tasks[t];
+    uint64_t value[4] = { 0, 0, 0, 0 };
+    int owner;
+
+    if (kind == MSG_FETCH) {
+        if (dhash_children(hash, arg[0], value)) {
+            dhash_store(task, slot, value);
+            return;
+        }
+        owner = dhash_owner(arg[0]);
+    } else if (kind == MSG_JOIN) {
+        if (dhash_all_empty(arg)) {
+            value[0] = dhash_empty(dhash_level(arg[0]) + 1);
+            dhash_store(task, slot, value);
+            return;
+        }
+        uint64_t key = dhash_key(arg);
+        owner = dhash_home(hash, key);
+        if (owner == hash->rank) {
+            value[0] = dhash_insert(hash, arg, key);
+            dhash_store(task, slot, value);
+            return;
+        }
+    } else {
+        if (dhash_lookup(hash, kind, arg[0], value)) {
+            dhash_store(task, slot, value);
+            return;
+        }
+        owner = dhash_owner(arg[0]);
+        if (owner == hash->rank) {
+            dhash_wait(hash, kind, arg[0], hash->rank, t, slot);
+            task->pending++;
+            return;
+        }
+    }
+
+    dhash_post(hash, owner, DHASH_OP(kind, t, slot), arg, kind == MSG_JOIN ? 4 : 1);
+    task->pending++;
+}
+
+/**
+ * @brief Next generations of a level-4 node, computed directly from its 16 leaves.
+ *
+ * @param gc   Leaves of the 16×16 square (4×4 grid).
+ * @param gens Generations to advance (1, 2 or 4).
+ * @param out  OUT: the four leaves of the advanced 8×8 center.
+ */
+static void dhash_base(const life_dnode_t gc[16], int gens, life_dnode_t out[4]) {
+    const unsigned rule = life_get_rule();
+
+    unsigned char cell[2][16][16];
+    for (int r = 0; r < 16; r++) {
+        for (int c = 0; c < 16; c++) {
+            cell[0][r][c] = (gc[(r >> 2) * 4 + (c >> 2)] >> ((r & 3) * 4 + (c & 3))) & 1;
+        }
+    }
+
+    // Every generation the valid area shrinks by one cell on each side
+    int cur = 0;
+    for (int g = 1; g <= gens; g++) {
+        for (int r = g; r < 16 - g; r++) {
+            for (int c = g; c < 16 - g; c++) {
+                int alive_neighbors = cell[cur][r - 1][c - 1] + cell[cur][r - 1][c] + cell[cur][r - 1][c + 1] +
+                                      cell[cur][r][c - 1]                           + cell[cur][r][c + 1] +
+                                      cell[cur][r + 1][c - 1] + cell[cur][r + 1][c] + cell[cur][r + 1][c + 1];
+                cell[cur ^ 1][r][c] = (unsigned char)LIFE_RULE_NEXT(rule, cell[cur][r][c], alive_neighbors);
+            }
+        }
+        cur ^= 1;
+    }
+
+    for (int q = 0; q < 4; q++) {
+        unsigned bits = 0;
+        for (int r = 0; r < 4; r++) {
+            for (int c = 0; c < 4; c++) {
+                bits |= (unsigned)cell[cur][4 + (q >> 1) * 4 + r][4 + (q & 1) * 4 + c] << (r * 4 + c);
+            }
+        }
+        out[q] = dhash_leaf(bits);
+    }
+}
+
+/**
+ * @brief Memoize the value of a finished task and answer everybody waiting for it.
+ */
+static void dhash_finish(life_dhash_t *hash, uint32_t t, uint64_t value) {
+    life_dhash_task_t *task = hash->tasks[t];
+    life_dhash_node_t *node = &hash->nodes[dhash_index(task->node)];
+    if (task->kind == MSG_POP)                                      node->population = value;
+    else if (dhash_full_speed(hash, dhash_level(task->node)))       node->result     = value;
+    else                                                            node->step       = value;
+    node->task = DHASH_NO_SLOT;
+
+    uint32_t w = task->waiters;
+    while (w != DHASH_NO_SLOT) {
+        life_dhash_waiter_t waiter = hash->waiters[w];
+        if (waiter.rank == DHASH_BROADCAST) dhash_broadcast(hash, value);
+        else dhash_post(hash, waiter.rank, DHASH_OP(MSG_VALUE, waiter.target, waiter.slot), &value, 1);
+
+        hash->waiters[w].next = hash->waiter_free;
+        hash->waiter_free = w;
+        w = waiter.next;
+    }
+
+    hash->task_free[hash->task_free_count++] = t;
+}
+
+/**
+ * @brief Run task t until it has to wait for replies (or is finished).
+ *
+ * RESULT of a node of level k (HashLife recursion, see hash_step()):
+ *   TASK_GC   grandchildren (children of the four children)
+ *   TASK_SUB  nine overlapping sub-squares (full speed), or
+ *   TASK_GGC  great-grandchildren (slower than full speed)
+ *   TASK_R    the nine sub-squares advanced, or just their centers
+ *   TASK_Q    regrouped into four squares
+ *   TASK_S    those advanced
+ *   TASK_OUT  joined into the result
+ * Level-4 nodes are computed directly from their 16 leaves. A POP task only
+ * collects the four children populations (TASK_S).
+ */
+static void dhash_task_run(life_dhash_t *hash, uint32_t t) {
+    life_dhash_task_t *task = hash->tasks[t];
+    int level = dhash_level(task->node);
+    int full  = dhash_full_speed(hash, level);
+
+    while (task->pending == 0) {
+        int state = task->state;
+
+        // Guard: replies answered on the spot must not complete the state while it is issued
+        task->pending = 1;
+
+        if (state == TASK_START) {
+            memcpy(task->child, hash->nodes[dhash_index(task->node)].child, sizeof(task->child));
+            task->state = (task->kind == MSG_POP) ? TASK_S : TASK_GC;
+            for (uint32_t q = 0; q < 4; q++) {
+                dhash_request(hash, t, q, task->kind == MSG_POP ? MSG_POP : MSG_FETCH, &task->child[q]);
+            }
+        } else if (state == TASK_GC && level == 4) {
+            life_dnode_t leaves[4];
+            dhash_base(task->gc, full ? 4 : 1 << hash->step_log, leaves);
+            task->state = TASK_OUT;
+            dhash_request(hash, t, 0, MSG_JOIN, leaves);
+        } else if (state == TASK_GC && full) {
+            task->state = TASK_SUB;
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) {
+                    uint32_t k = (uint32_t)(i * 3 + j);
+                    if (!(i & 1) && !(j & 1)) {
+                        task->sub[k] = task->child[(i >> 1) * 2 + (j >> 1)];
+                        continue;
+                    }
+                    life_dnode_t c[4] = { task->gc[i * 4 + j],       task->gc[i * 4 + j + 1],
+                                          task->gc[(i + 1) * 4 + j], task->gc[(i + 1) * 4 + j + 1] };
+                    dhash_request(hash, t, k, MSG_JOIN, c);
+                }
+            }
+        } else if (state == TASK_GC) {
+            task->state = TASK_GGC;
+            for (uint32_t g = 0; g < 16; g++) dhash_request(hash, t, g, MSG_FETCH, &task->gc[g]);
+        } else if (state == TASK_SUB) {
+            task->state = TASK_R;
+            for (uint32_t k = 0; k < 9; k++) dhash_request(hash, t, k, MSG_RESULT, &task->sub[k]);
+        } else if (state == TASK_GGC) {
+            // Centers of the nine sub-squares, straight from the 8×8 grid
+            task->state = TASK_R;
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) {
+                    int r = 2 * i + 1, c = 2 * j + 1;
+                    life_dnode_t quad[4] = { task->ggc[r * 8 + c],       task->ggc[r * 8 + c + 1],
+                                             task->ggc[(r + 1) * 8 + c], task->ggc[(r + 1) * 8 + c + 1] };
+                    dhash_request(hash, t, (uint32_t)(i * 3 + j), MSG_JOIN, quad);
+                }
+            }
+        } else if (state == TASK_R) {
+            task->state = TASK_Q;
+            for (int a = 0; a < 2; a++) {
+                for (int b = 0; b < 2; b++) {
+                    life_dnode_t quad[4] = { task->r[a * 3 + b],       task->r[a * 3 + b + 1],
+                                             task->r[(a + 1) * 3 + b], task->r[(a + 1) * 3 + b + 1] };
+                    dhash_request(hash, t, (uint32_t)(a * 2 + b), MSG_JOIN, quad);
+                }
+            }
+        } else if (state == TASK_Q) {
+            task->state = TASK_S;
+            for (uint32_t k = 0; k < 4; k++) dhash_request(hash, t, k, MSG_RESULT, &task->q[k]);
+        } else if (state == TASK_S && task->kind == MSG_RESULT) {
+            task->state = TASK_OUT;
+            dhash_request(hash, t, 0, MSG_JOIN, task->s);
+        } else {
+            uint64_t value = task->out;
+            if (task->kind == MSG_POP) value = task->s[0] + task->s[1] + task->s[2] + task->s[3];
+            dhash_finish(hash, t, value);
+            return;
+        }
+
+        task->pending--;
+    }
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Serve one message (request or reply) sent by rank src.
+ */
+static void dhash_handle(life_dhash_t *hash, int src, const life_dhash_msg_t *msg) {
+    int kind        = (int)(msg->op & 0xFF);
+    uint32_t slot   = (uint32_t)(msg->op >> 8) & 0xFF;
+    uint32_t target = (uint32_t)(msg->op >> 16);
+    uint64_t value[4] = { 0, 0, 0, 0 };
+
+    switch (kind) {
+    case MSG_FETCH:
+        dhash_children(hash, msg->arg[0], value);
+        dhash_post(hash, src, DHASH_OP(MSG_CHILDREN, target, slot), value, 4);
+        break;
+    case MSG_JOIN:
+        value[0] = dhash_insert(hash, msg->arg, dhash_key(msg->arg));
+        dhash_post(hash, src, DHASH_OP(MSG_VALUE, target, slot), value, 1);
+        break;
+    case MSG_RESULT:
+    case MSG_POP:
+        if (dhash_lookup(hash, kind, msg->arg[0], value)) {
+            dhash_post(hash, src, DHASH_OP(MSG_VALUE, target, slot), value, 1);
+        } else {
+            dhash_wait(hash, kind, msg->arg[0], src, target, slot);
+        }
+        break;
+    case MSG_MARK:
+        dhash_mark(hash, msg->arg[0]);
+        break;
+    case MSG_CHILDREN:
+    case MSG_VALUE:
+        dhash_deliver(hash, target, slot, msg->arg);
+        break;
+    case MSG_DONE:
+        hash->done       = 1;
+        hash->done_value = msg->arg[0];
+        break;
+    }
+}
+
+/**
+ * @brief Run local work (own replies, ready tasks) until only remote requests are left.
+ */
+static void dhash_drain(life_dhash_t *hash) {
+    size_t *local = &hash->outbox_count[hash->rank];
+    while (*local > 0 || hash->ready_count > 0) {
+        while (*local > 0) {
+            life_dhash_msg_t msg = hash->outbox[hash->rank][--*local];
+            dhash_handle(hash, hash->rank, &msg);
+        }
+        while (hash->ready_count > 0) {
+            dhash_task_run(hash, hash->ready[--hash->ready_count]);
+        }
+    }
+}
+
+/**
+ * @brief One superstep: send every outbox with a single all-to-all, then serve what arrived.
+ */
+static void dhash_exchange(life_dhash_t *hash) {
+    size_t total = 0;
+    for (int r = 0; r < hash->size; r++) {
+        if (r != hash->rank) total += hash->outbox_count[r];
+    }
+
+    size_t capacity = (size_t)hash->send_capacity;
+    hash->send = dhash_reserve(hash, hash->send, &capacity, total * MSG_WORDS + 1, sizeof(uint64_t));
+    hash->send_capacity = (long)capacity;
+
+    uint64_t *p = hash->send;
+    for (int r = 0; r < hash->size; r++) {
+        size_t n = (r == hash->rank) ? 0 : hash->outbox_count[r];
+        memcpy(p, hash->outbox[r], n * sizeof(life_dhash_msg_t));
+        p += n * MSG_WORDS;
+        hash->send_counts[r] = (int)(n * MSG_WORDS);
+        if (r != hash->rank) hash->outbox_count[r] = 0;
+    }
+
+    mpi_exchange_batches(hash->send, hash->send_counts, &hash->recv, hash->recv_counts,
+                         &hash->recv_capacity, hash->comm);
+    hash->supersteps++;
+
+    const uint64_t *in = hash->recv;
+    for (int r = 0; r < hash->size; r++) {
+        for (int k = 0; k < hash->recv_counts[r]; k += MSG_WORDS) {
+            life_dhash_msg_t msg;
+            memcpy(&msg, in, sizeof(msg));
+            dhash_handle(hash, r, &msg);
+            in += MSG_WORDS;
+        }
+    }
+}
+
+/**
+ * @brief RESULT or POP value of node n, computed by all ranks together (same value everywhere).
+ *
+ * The owner of n starts the task; supersteps run until its value has been
+ * broadcast. Every request is answered before the value of n is known, so
+ * no message is left in flight afterwards.
+ */
+static uint64_t dhash_compute(life_dhash_t *hash, int kind, life_dnode_t n) {
+    uint64_t value = 0;
+    if (dhash_is_inline(n)) {
+        dhash_lookup(hash, kind, n, &value);
+        return value;
+    }
+
+    hash->done = 0;
+    if (dhash_owner(n) == hash->rank) {
+        if (dhash_lookup(hash, kind, n, &value)) dhash_broadcast(hash, value);
+        else dhash_wait(hash, kind, n, DHASH_BROADCAST, 0, 0);
+    }
+
+    do {
+        dhash_drain(hash);
+        dhash_exchange(hash);
+    } while (!hash->done);
+
+    return hash->done_value;
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Children of node n on every rank (the owner broadcasts them).
+ */
+static void dhash_children_all(life_dhash_t *hash, life_dnode_t n, life_dnode_t out[4]) {
+    if (dhash_is_inline(n)) {
+        dhash_children(hash, n, out);
+        return;
+    }
+    int owner = dhash_owner(n);
+    if (owner == hash->rank) dhash_children(hash, n, out);
+    MPI_Bcast(out, 4, MPI_UINT64_T, owner, hash->comm);
+}
+
+/**
+ * @brief Canonical node with the given quadrants on every rank (its home inserts and broadcasts it).
+ */
+static life_dnode_t dhash_join_all(life_dhash_t *hash, const life_dnode_t c[4]) {
+    if (dhash_all_empty(c)) return dhash_empty(dhash_level(c[0]) + 1);
+
+    uint64_t key = dhash_key(c);
+    int owner = dhash_home(hash, key);
+    life_dnode_t n = 0;
+    if (owner == hash->rank) n = dhash_insert(hash, c, key);
+    MPI_Bcast(&n, 1, MPI_UINT64_T, owner, hash->comm);
+    return n;
+}
+
+/**
+ * @brief Joins requested by this rank, answered in two supersteps (request, reply).
+ *
+ * @param count Number of joins requested by this rank (may differ between ranks).
+ * @param quads Children of every join, 4 per join.
+ * @param out   OUT: node of every join.
+ */
+static void dhash_join_batch(life_dhash_t *hash, size_t count, const life_dnode_t *quads, life_dnode_t *out) {
+    hash->batch = out;
+    for (size_t i = 0; i < count; i++) {
+        const life_dnode_t *c = quads + 4 * i;
+        if (dhash_all_empty(c)) {
+            out[i] = dhash_empty(dhash_level(c[0]) + 1);
+            continue;
+        }
+        uint64_t key = dhash_key(c);
+        int owner = dhash_home(hash, key);
+        if (owner == hash->rank) out[i] = dhash_insert(hash, c, key);
+        else dhash_post(hash, owner, DHASH_OP(MSG_JOIN, i, 0), c, 4);
+    }
+
+    dhash_exchange(hash);   // joins reach their home, which replies
+    dhash_exchange(hash);   // replies land in out
+    hash->batch = NULL;
+}
+
+life_dhash_t* life_dhash_create(size_t max_bytes, MPI_Comm comm) {
+    life_dhash_t *hash = calloc(1, sizeof(life_dhash_t));
+    if (!hash) return NULL;
+
+    hash->comm = comm;
+    MPI_Comm_rank(comm, &hash->rank);
+    MPI_Comm_size(comm, &hash->size);
+
+    // Largest power of two of nodes (plus their bucket) within the cap
+    size_t max_nodes = DHASH_MIN_CAPACITY;
+    while (max_nodes * 2 * (sizeof(life_dhash_node_t) + sizeof(uint32_t)) <= max_bytes &&
+           max_nodes * 2 < (size_t)DHASH_NO_SLOT) {
+        max_nodes *= 2;
+    }
+
+    hash->max_nodes       = max_nodes;
+    hash->capacity        = DHASH_MIN_CAPACITY;
+    hash->nodes           = calloc(hash->capacity, sizeof(life_dhash_node_t));
+    hash->bucket          = malloc(hash->capacity * sizeof(uint32_t));
+    hash->outbox          = calloc(hash->size, sizeof(life_dhash_msg_t*));
+    hash->outbox_count    = calloc(hash->size, sizeof(size_t));
+    hash->outbox_capacity = calloc(hash->size, sizeof(size_t));
+    hash->send_counts     = calloc(hash->size, sizeof(int));
+    hash->recv_counts     = calloc(hash->size, sizeof(int));
+    if (!hash->nodes || !hash->bucket || !hash->outbox || !hash->outbox_count ||
+        !hash->outbox_capacity || !hash->send_counts || !hash->recv_counts) {
+        life_dhash_destroy(hash);
+        return NULL;
+    }
+    memset(hash->bucket, 0xFF, hash->capacity * sizeof(uint32_t));
+
+    hash->free_list   = DHASH_NO_SLOT;
+    hash->waiter_free = DHASH_NO_SLOT;
+    hash->step_log    = -1;
+    hash->root        = dhash_empty(4);
+    return hash;
+}
+
+void life_dhash_destroy(life_dhash_t *hash) {
+    if (!hash) return;
+
+    for (size_t t = 0; t < hash->task_count; t++) free(hash->tasks[t]);
+    if (hash->outbox) {
+        for (int r = 0; r < hash->size; r++) free(hash->outbox[r]);
+    }
+    free(hash->tasks);
+    free(hash->task_free);
+    free(hash->ready);
+    free(hash->waiters);
+    free(hash->outbox);
+    free(hash->outbox_count);
+    free(hash->outbox_capacity);
+    free(hash->send);
+    free(hash->recv);
+    free(hash->send_counts);
+    free(hash->recv_counts);
+    free(hash->nodes);
+    free(hash->bucket);
+    free(hash);
+}
+
+uint64_t life_dhash_population(life_dhash_t *hash) {
+    return dhash_compute(hash, MSG_POP, hash->root);
+}
+
+int life_dhash_load(life_dhash_t *hash, const char *board, int rows, int cols) {
+    int level = 4;
+    while ((1L << level) < rows || (1L << level) < cols) level++;
+
+    // MASTER cuts the board into 4×4 leaves...
+    size_t grid_rows = 0, grid_cols = 0;
+    life_dnode_t *grid = NULL;
+    if (hash->rank == 0) {
+        grid_rows = ((size_t)rows + 3) / 4;
+        grid_cols = ((size_t)cols + 3) / 4;
+        grid = malloc(grid_rows * grid_cols * sizeof(life_dnode_t));
+        if (!grid) {
+            fprintf(stderr, "Error: malloc failed in life_dhash_load\n");
+            MPI_Abort(hash->comm, EXIT_FAILURE);
+        }
+        for (size_t gr = 0; gr < grid_rows; gr++) {
+            for (size_t gc = 0; gc < grid_cols; gc++) {
+                unsigned bits = 0;
+                for (size_t r = gr * 4; r < gr * 4 + 4 && r < (size_t)rows; r++) {
+                    for (size_t c = gc * 4; c < gc * 4 + 4 && c < (size_t)cols; c++) {
+                        bits |= (unsigned)(board[r * cols + c] != 0) << ((r & 3) * 4 + (c & 3));
+                    }
+                }
+                grid[gr * grid_cols + gc] = dhash_leaf(bits);
+            }
+        }
+    }
+
+    // ...and joins them level by level, one batch of requests per level
+    hash->full = 0;
+    for (int k = 3; k <= level; k++) {
+        size_t next_rows = (grid_rows + 1) / 2, next_cols = (grid_cols + 1) / 2;
+        size_t count = next_rows * next_cols;
+        life_dnode_t *quads = NULL, *next = NULL;
+        if (count > 0) {
+            quads = malloc(4 * count * sizeof(life_dnode_t));
+            next  = malloc(count * sizeof(life_dnode_t));
+            if (!quads || !next) {
+                fprintf(stderr, "Error: malloc failed in life_dhash_load\n");
+                MPI_Abort(hash->comm, EXIT_FAILURE);
+            }
+        }
+        for (size_t i = 0; i < next_rows; i++) {
+            for (size_t j = 0; j < next_cols; j++) {
+                for (int q = 0; q < 4; q++) {
+                    size_t r = 2 * i + (q >> 1), c = 2 * j + (q & 1);
+                    quads[4 * (i * next_cols + j) + q] = (r < grid_rows && c < grid_cols)
+                                                         ? grid[r * grid_cols + c] : dhash_empty(k - 1);
+                }
+            }
+        }
+
+        dhash_join_batch(hash, count, quads, next);
+        free(quads);
+        free(grid);
+        grid      = next;
+        grid_rows = next_rows;
+        grid_cols = next_cols;
+    }
+
+    life_dnode_t root = (hash->rank == 0) ? grid[0] : 0;
+    free(grid);
+    MPI_Bcast(&root, 1, MPI_UINT64_T, 0, hash->comm);
+
+    if (mpi_allreduce_count(hash->full, hash->comm) > 0) {
+        hash->full = 0;
+        return -1;
+    }
+
+    hash->root       = root;
+    hash->origin_row = 0;
+    hash->origin_col = 0;
+    return 0;
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Non-zero if every alive cell of n lies in its quadrant q, and so on `depth` times.
+ */
+static int dhash_within(life_dhash_t *hash, life_dnode_t n, int q, int depth) {
+    if (depth == 0 || dhash_is_empty(n)) return 1;
+    if (dhash_level(n) == 2) {
+        // Quadrant q of a 4×4 leaf (depth 1: only called on level-3 children of the root's children)
+        static const unsigned quadrant[4] = { 0x0033, 0x00CC, 0x3300, 0xCC00 };
+        return ((unsigned)(n & 0xFFFF) & ~quadrant[q]) == 0;
+    }
+
+    life_dnode_t c[4];
+    dhash_children_all(hash, n, c);
+    for (int k = 0; k < 4; k++) {
+        if (k != q && !dhash_is_empty(c[k])) return 0;
+    }
+    return dhash_within(hash, c[q], q, depth - 1);
+}
+
+/**
+ * @brief Non-zero if every alive cell of the root lies in its central 2^(level-2) square.
+ */
+static int dhash_inner(life_dhash_t *hash) {
+    life_dnode_t c[4];
+    dhash_children_all(hash, hash->root, c);
+    for (int q = 0; q < 4; q++) {
+        if (!dhash_within(hash, c[q], 3 - q, 2)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Double the root around its center with dead space.
+ */
+static void dhash_expand(life_dhash_t *hash) {
+    int level = dhash_level(hash->root);
+    life_dnode_t c[4];
+    dhash_children_all(hash, hash->root, c);
+
+    life_dnode_t e = dhash_empty(level - 1);
+    life_dnode_t quads[4][4] = { { e, e, e, c[0] }, { e, e, c[1], e }, { e, c[2], e, e }, { c[3], e, e, e } };
+    life_dnode_t top[4];
+    for (int q = 0; q < 4; q++) top[q] = dhash_join_all(hash, quads[q]);
+
+    hash->root = dhash_join_all(hash, top);
+    hash->origin_row -= (int64_t)1 << (level - 1);
+    hash->origin_col -= (int64_t)1 << (level - 1);
+}
+
+/**
+ * @brief One jump of 2^j generations; -1 (on every rank) if a table filled up on the way.
+ */
+static int dhash_advance_once(life_dhash_t *hash, int j) {
+    int min_level = (j + 3 > 4) ? j + 3 : 4;
+    while (dhash_level(hash->root) < min_level || !dhash_inner(hash)) {
+        if (dhash_level(hash->root) >= LIFE_DHASH_MAX_LEVEL) return -1;
+        dhash_expand(hash);
+        if (mpi_allreduce_count(hash->full, hash->comm) > 0) return -1;
+    }
+
+    // Slower-than-full-speed results are only valid for one step size
+    if (j != hash->step_log) {
+        for (size_t i = 0; i < hash->count; i++) hash->nodes[i].step = LIFE_DHASH_NONE;
+        hash->step_log = j;
+    }
+
+    int level = dhash_level(hash->root);
+    life_dnode_t res = dhash_compute(hash, MSG_RESULT, hash->root);
+    if (mpi_allreduce_count(hash->full, hash->comm) > 0) return -1;
+
+    hash->root = res;
+    hash->origin_row += (int64_t)1 << (level - 2);
+    hash->origin_col += (int64_t)1 << (level - 2);
+    return 0;
+}
+
+int life_dhash_advance(life_dhash_t *hash, int log2_gens) {
+    // Keep headroom: collect before any table reaches its cap
+    if (mpi_allreduce_count(hash->live > hash->max_nodes / 4 * 3, hash->comm) > 0) {
+        life_dhash_collect(hash, 1);
+        if (mpi_allreduce_count(hash->live > hash->max_nodes / 2, hash->comm) > 0) life_dhash_collect(hash, 0);
+    }
+
+    life_dnode_t root = hash->root;
+    int64_t origin_row = hash->origin_row, origin_col = hash->origin_col;
+    if (dhash_advance_once(hash, log2_gens) == 0) return 0;
+
+    // Out of nodes: results built on the way may be wrong, drop them all and retry
+    hash->full = 0;
+    hash->root = root;
+    hash->origin_row = origin_row;
+    hash->origin_col = origin_col;
+    life_dhash_collect(hash, 0);
+    if (dhash_advance_once(hash, log2_gens) == 0) return 0;
+
+    hash->full = 0;
+    hash->root = root;
+    hash->origin_row = origin_row;
+    hash->origin_col = origin_col;
+    life_dhash_collect(hash, 0);
+    if (log2_gens == 0) return -1;
+
+    // Still too big: two jumps of half the size
+    if (life_dhash_advance(hash, log2_gens - 1) != 0) return -1;
+    return life_dhash_advance(hash, log2_gens - 1);
+}
+
+/**
+ * @brief Mark node n and everything reachable from it (remote nodes by message).
+ */
+static void dhash_mark(life_dhash_t *hash, life_dnode_t n) {
+    if (n == LIFE_DHASH_NONE || dhash_is_inline(n)) return;
+
+    int owner = dhash_owner(n);
+    if (owner != hash->rank) {
+        dhash_post(hash, owner, DHASH_OP(MSG_MARK, 0, 0), &n, 1);
+        return;
+    }
+
+    life_dhash_node_t *node = &hash->nodes[dhash_index(n)];
+    if (node->flags & DHASH_MARK) return;
+    node->flags |= DHASH_MARK;
+
+    for (int q = 0; q < 4; q++) dhash_mark(hash, node->child[q]);
+    if (hash->keep_results) {
+        dhash_mark(hash, node->result);
+        dhash_mark(hash, node->step);
+    }
+}
+
+void life_dhash_collect(life_dhash_t *hash, int keep_results) {
+    for (size_t i = 0; i < hash->count; i++) {
+        hash->nodes[i].flags &= (uint8_t)~DHASH_MARK;
+        if (!keep_results) hash->nodes[i].result = hash->nodes[i].step = LIFE_DHASH_NONE;
+    }
+
+    // Mark from the root; marks hop between ranks until no rank sends any
+    hash->keep_results = keep_results;
+    if (!dhash_is_inline(hash->root) && dhash_owner(hash->root) == hash->rank) dhash_mark(hash, hash->root);
+
+    long sent;
+    do {
+        sent = 0;
+        for (int r = 0; r < hash->size; r++) {
+            if (r != hash->rank) sent += (long)hash->outbox_count[r];
+        }
+        dhash_exchange(hash);
+    } while (mpi_allreduce_count(sent, hash->comm) > 0);
+
+    // Sweep: survivors go back into the hash chains, the rest into the free list
+    memset(hash->bucket, 0xFF, hash->capacity * sizeof(uint32_t));
+    hash->free_list = DHASH_NO_SLOT;
+    hash->live = 0;
+    for (size_t i = hash->count; i-- > 0;) {
+        life_dhash_node_t *node = &hash->nodes[i];
+        if ((node->flags & DHASH_LIVE) && (node->flags & DHASH_MARK)) {
+            size_t b = dhash_key(node->child) & (hash->capacity - 1);
+            node->next = hash->bucket[b];
+            hash->bucket[b] = (uint32_t)i;
+            hash->live++;
+        } else {
+            node->flags = 0;
+            node->result = node->step = LIFE_DHASH_NONE;
+            node->next = hash->free_list;
+            hash->free_list = (uint32_t)i;
+        }
+    }
+    hash->collections++;
+}
+
+/* ********************************************************************************************* */
@@ -0,0 +1,422 @@
+//    _____      _     ___        __                     __                 
+//   |_   _|    (_)  .' ..]      [  |                   [  |                
+//     | |      __  _| |_  .---.  | |--.   ,--.   .--.   | |--.      .---.  
+//     | |   _ [  |'-| |-'/ /__\\ | .-. | `'_\ : ( (`\]  | .-. |    / /'`\] 
+//    _| |__/ | | |  | |  | \__., | | | | // | |, `'.'.  | | | |  _ | \__.  
+//   |________|[___][___]  '.__.'[___]|__]\'-;__/[\__) )[___]|__](_)'.___.' 
+//                                                                          
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "life.h"
+#include "lifehash.h"
+
+/* ********************************************************************************************* */
+
+#define HASH_LIVE 1     // slot holds a node of the table
+#define HASH_MARK 2     // reached by the current collection
+
+#define HASH_MIN_CAPACITY ((size_t)1 << 12)
+
+static inline uint64_t hash_key(life_node_t nw, life_node_t ne, life_node_t sw, life_node_t se) {
+    uint64_t h = ((uint64_t)nw << 32 | ne) * 0x9E3779B97F4A7C15ULL;
+    h ^= ((uint64_t)sw << 32 | se) * 0xC2B2AE3D27D4EB4FULL;
+    return h ^ (h >> 29);
+}
+
+/**
+ * @brief Double the node table and rebuild the hash chains (bounded by max_nodes).
+ */
+static int hash_grow(life_hash_t *hash) {
+    size_t capacity = hash->capacity * 2;
+    if (capacity > hash->max_nodes) return -1;
+
+    life_hash_node_t *nodes = realloc(hash->nodes, capacity * sizeof(life_hash_node_t));
+    if (!nodes) return -1;
+    hash->nodes = nodes;
+
+    life_node_t *bucket = realloc(hash->bucket, capacity * sizeof(life_node_t));
+    if (!bucket) return -1;
+    hash->bucket   = bucket;
+    hash->capacity = capacity;
+
+    memset(hash->bucket, 0xFF, capacity * sizeof(life_node_t));
+    for (size_t i = 2; i < hash->count; i++) {
+        life_hash_node_t *node = &hash->nodes[i];
+        if (!(node->flags & HASH_LIVE)) continue;
+        size_t b = hash_key(node->child[0], node->child[1], node->child[2], node->child[3]) & (capacity - 1);
+        node->next = hash->bucket[b];
+        hash->bucket[b] = (life_node_t)i;
+    }
+    return 0;
+}
+
+/**
+ * @brief Canonical node with the given quadrants (created if not in the table yet).
+ *
+ * If the table is full, sets hash->full and returns the empty node of that
+ * level so the caller can unwind; the work is then discarded.
+ */
+static life_node_t hash_join(life_hash_t *hash, life_node_t nw, life_node_t ne,
+                             life_node_t sw, life_node_t se) {
+    uint64_t key = hash_key(nw, ne, sw, se);
+    size_t b = key & (hash->capacity - 1);
+    for (life_node_t n = hash->bucket[b]; n != LIFE_HASH_NONE; n = hash->nodes[n].next) {
+        const life_hash_node_t *node = &hash->nodes[n];
+        if (node->child[0] == nw && node->child[1] == ne && node->child[2] == sw && node->child[3] == se) {
+            return n;
+        }
+    }
+
+    int level = hash->nodes[nw].level + 1;
+
+    // Take a released slot, then a fresh one, then grow the table
+    life_node_t n;
+    if (hash->free_list != LIFE_HASH_NONE) {
+        n = hash->free_list;
+        hash->free_list = hash->nodes[n].next;
+    } else {
+        if (hash->count == hash->capacity) {
+            if (hash_grow(hash) != 0) {
+                hash->full = 1;
+                return hash->empty[level];
+            }
+            b = key & (hash->capacity - 1);
+        }
+        n = (life_node_t)hash->count++;
+    }
+
+    life_hash_node_t *node = &hash->nodes[n];
+    node->child[0]   = nw;
+    node->child[1]   = ne;
+    node->child[2]   = sw;
+    node->child[3]   = se;
+    node->result     = LIFE_HASH_NONE;
+    node->step       = LIFE_HASH_NONE;
+    node->level      = (uint8_t)level;
+    node->flags      = HASH_LIVE;
+    node->population = hash->nodes[nw].population + hash->nodes[ne].population +
+                       hash->nodes[sw].population + hash->nodes[se].population;
+    node->next       = hash->bucket[b];
+    hash->bucket[b]  = n;
+    hash->live++;
+    return n;
+}
+
+life_hash_t* life_hash_create(size_t max_bytes) {
+    life_hash_t *hash = calloc(1, sizeof(life_hash_t));
+    if (!hash) return NULL;
+
+    // Largest power of two of nodes (plus their bucket) within the cap
+    size_t max_nodes = HASH_MIN_CAPACITY;
+    while (max_nodes * 2 * (sizeof(life_hash_node_t) + sizeof(life_node_t)) <= max_bytes &&
+           max_nodes * 2 <= (size_t)UINT32_MAX) {
+        max_nodes *= 2;
+    }
+
+    hash->max_nodes = max_nodes;
+    hash->capacity  = HASH_MIN_CAPACITY;
+    hash->nodes     = calloc(hash->capacity, sizeof(life_hash_node_t));
+    hash->bucket    = malloc(hash->capacity * sizeof(life_node_t));
+    if (!hash->nodes || !hash->bucket) {
+        life_hash_destroy(hash);
+        return NULL;
+    }
+    memset(hash->bucket, 0xFF, hash->capacity * sizeof(life_node_t));
+
+    // Leaves: a dead and an alive cell
+    for (int leaf = 0; leaf < 2; leaf++) {
+        life_hash_node_t *node = &hash->nodes[leaf];
+        node->child[0] = node->child[1] = node->child[2] = node->child[3] = LIFE_HASH_NONE;
+        node->result     = node->step = LIFE_HASH_NONE;
+        node->flags      = HASH_LIVE;
+        node->population = (uint64_t)leaf;
+    }
+    hash->count     = 2;
+    hash->live      = 2;
+    hash->free_list = LIFE_HASH_NONE;
+    hash->step_log  = -1;
+
+    hash->empty[0] = LIFE_HASH_DEAD;
+    for (int level = 1; level <= LIFE_HASH_MAX_LEVEL; level++) {
+        life_node_t e = hash->empty[level - 1];
+        hash->empty[level] = hash_join(hash, e, e, e, e);
+    }
+    hash->root = hash->empty[3];
+    return hash;
+}
+
+void life_hash_destroy(life_hash_t *hash) {
+    if (hash) {
+        free(hash->nodes);
+        free(hash->bucket);
+        free(hash);
+    }
+}
+
+uint64_t life_hash_population(const life_hash_t *hash) {
+    return hash->nodes[hash->root].population;
+}
+
+/**
+ * @brief Build the node of the 2^level square at (r0, c0) of a plain board.
+ */
+static life_node_t hash_build(life_hash_t *hash, const char *board, int rows, int cols,
+                              int r0, int c0, int level) {
+    if (r0 >= rows || c0 >= cols) return hash->empty[level];
+    if (level == 0) return board[(size_t)r0 * cols + c0] ? LIFE_HASH_ALIVE : LIFE_HASH_DEAD;
+
+    int half = 1 << (level - 1);
+    life_node_t nw = hash_build(hash, board, rows, cols, r0,        c0,        level - 1);
+    life_node_t ne = hash_build(hash, board, rows, cols, r0,        c0 + half, level - 1);
+    life_node_t sw = hash_build(hash, board, rows, cols, r0 + half, c0,        level - 1);
+    life_node_t se = hash_build(hash, board, rows, cols, r0 + half, c0 + half, level - 1);
+    return hash_join(hash, nw, ne, sw, se);
+}
+
+int life_hash_load(life_hash_t *hash, const char *board, int rows, int cols) {
+    int level = 3;
+    while ((1L << level) < rows || (1L << level) < cols) level++;
+
+    hash->full = 0;
+    life_node_t root = hash_build(hash, board, rows, cols, 0, 0, level);
+    if (hash->full) {
+        hash->full = 0;
+        return -1;
+    }
+
+    hash->root       = root;
+    hash->origin_row = 0;
+    hash->origin_col = 0;
+    return 0;
+}
+
+/* ********************************************************************************************* */
+
+#define NW(n) (hash->nodes[n].child[0])
+#define NE(n) (hash->nodes[n].child[1])
+#define SW(n) (hash->nodes[n].child[2])
+#define SE(n) (hash->nodes[n].child[3])
+
+/**
+ * @brief Next generation of the 2×2 center of a level-2 (4×4) node.
+ */
+static life_node_t hash_base(life_hash_t *hash, life_node_t n) {
+    const unsigned rule = life_get_rule();
+
+    // Cell (r, c) of the 4×4 square as bit r*4 + c
+    unsigned bits = 0;
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 4; c++) {
+            life_node_t quad = hash->nodes[n].child[(r >> 1) * 2 + (c >> 1)];
+            life_node_t leaf = hash->nodes[quad].child[(r & 1) * 2 + (c & 1)];
+            bits |= (unsigned)(leaf == LIFE_HASH_ALIVE) << (r * 4 + c);
+        }
+    }
+
+    life_node_t out[4];
+    for (int k = 0; k < 4; k++) {
+        int r = 1 + (k >> 1), c = 1 + (k & 1);
+        int alive_neighbors = 0;
+        for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+                if (dr || dc) alive_neighbors += (bits >> ((r + dr) * 4 + c + dc)) & 1;
+            }
+        }
+        int is_alive = (bits >> (r * 4 + c)) & 1;
+        out[k] = LIFE_RULE_NEXT(rule, is_alive, alive_neighbors) ? LIFE_HASH_ALIVE : LIFE_HASH_DEAD;
+    }
+    return hash_join(hash, out[0], out[1], out[2], out[3]);
+}
+
+/**
+ * @brief Center 2^(level-1) square of a node, not advanced.
+ */
+static life_node_t hash_center(life_hash_t *hash, life_node_t n) {
+    return hash_join(hash, SE(NW(n)), SW(NE(n)), NE(SW(n)), NW(SE(n)));
+}
+
+/**
+ * @brief Center 2^(level-1) square of node n after 2^j generations (j ≤ level-2), memoized.
+ *
+ * The nine overlapping sub-squares of half size are advanced (by 2^(level-3)
+ * generations at full speed, or not at all when j is smaller), regrouped
+ * into four squares and advanced again: the RESULT recursion of HashLife.
+ */
+static life_node_t hash_step(life_hash_t *hash, life_node_t n, int j) {
+    life_hash_node_t *node = &hash->nodes[n];
+    int level = node->level;
+
+    if (node->population == 0) return hash->empty[level - 1];
+    if (j == level - 2 && node->result != LIFE_HASH_NONE) return node->result;
+    if (j <  level - 2 && node->step   != LIFE_HASH_NONE) return node->step;
+
+    life_node_t res;
+    if (level == 2) {
+        res = hash_base(hash, n);
+    } else {
+        life_node_t nw = NW(n), ne = NE(n), sw = SW(n), se = SE(n);
+        life_node_t sub[9] = {
+            nw,
+            hash_join(hash, NE(nw), NW(ne), SE(nw), SW(ne)),
+            ne,
+            hash_join(hash, SW(nw), SE(nw), NW(sw), NE(sw)),
+            hash_join(hash, SE(nw), SW(ne), NE(sw), NW(se)),
+            hash_join(hash, SW(ne), SE(ne), NW(se), NE(se)),
+            sw,
+            hash_join(hash, NE(sw), NW(se), SE(sw), SW(se)),
+            se
+        };
+
+        // First half of the jump (skipped when stepping slower than full speed)
+        life_node_t r[9];
+        for (int k = 0; k < 9; k++) {
+            r[k] = (j == level - 2) ? hash_step(hash, sub[k], level - 3) : hash_center(hash, sub[k]);
+        }
+
+        // Second half: regroup into four squares and advance their centers
+        int j2 = (j == level - 2) ? level - 3 : j;
+        res = hash_join(hash,
+                        hash_step(hash, hash_join(hash, r[0], r[1], r[3], r[4]), j2),
+                        hash_step(hash, hash_join(hash, r[1], r[2], r[4], r[5]), j2),
+                        hash_step(hash, hash_join(hash, r[3], r[4], r[6], r[7]), j2),
+                        hash_step(hash, hash_join(hash, r[4], r[5], r[7], r[8]), j2));
+    }
+
+    // The table may have been reallocated while recursing
+    if (j == level - 2) hash->nodes[n].result = res;
+    else                hash->nodes[n].step   = res;
+    return res;
+}
+
+/**
+ * @brief Non-zero if every alive cell of node n lies in its central 2^(level-2) square.
+ */
+static int hash_inner(const life_hash_t *hash, life_node_t n) {
+    uint64_t inner = hash->nodes[SE(SE(NW(n)))].population + hash->nodes[SW(SW(NE(n)))].population +
+                     hash->nodes[NE(NE(SW(n)))].population + hash->nodes[NW(NW(SE(n)))].population;
+    return inner == hash->nodes[n].population;
+}
+
+/**
+ * @brief Double the root around its center with dead space.
+ */
+static void hash_expand(life_hash_t *hash) {
+    life_node_t n = hash->root;
+    int level = hash->nodes[n].level;
+    life_node_t e = hash->empty[level - 1];
+
+    hash->root = hash_join(hash, hash_join(hash, e, e, e, NW(n)), hash_join(hash, e, e, NE(n), e),
+                                 hash_join(hash, e, SW(n), e, e), hash_join(hash, SE(n), e, e, e));
+    hash->origin_row -= (int64_t)1 << (level - 1);
+    hash->origin_col -= (int64_t)1 << (level - 1);
+}
+
+/**
+ * @brief One jump of 2^j generations; -1 if the table filled up on the way.
+ */
+static int hash_advance_once(life_hash_t *hash, int j) {
+    while (hash->nodes[hash->root].level < j + 3 || !hash_inner(hash, hash->root)) {
+        if (hash->nodes[hash->root].level >= LIFE_HASH_MAX_LEVEL) return -1;
+        hash_expand(hash);
+        if (hash->full) return -1;
+    }
+
+    // Slower-than-full-speed results are only valid for one step size
+    if (j != hash->step_log) {
+        for (size_t i = 0; i < hash->count; i++) hash->nodes[i].step = LIFE_HASH_NONE;
+        hash->step_log = j;
+    }
+
+    int level = hash->nodes[hash->root].level;
+    life_node_t res = hash_step(hash, hash->root, j);
+    if (hash->full) return -1;
+
+    hash->root = res;
+    hash->origin_row += (int64_t)1 << (level - 2);
+    hash->origin_col += (int64_t)1 << (level - 2);
+    return 0;
+}
+
+int life_hash_advance(life_hash_t *hash, int log2_gens) {
+    // Keep headroom: collect before the table reaches its cap
+    if (hash->live > hash->max_nodes / 4 * 3) {
+        life_hash_collect(hash, 1);
+        if (hash->live > hash->max_nodes / 2) life_hash_collect(hash, 0);
+    }
+
+    life_node_t root = hash->root;
+    int64_t origin_row = hash->origin_row, origin_col = hash->origin_col;
+    if (hash_advance_once(hash, log2_gens) == 0) return 0;
+
+    // Out of nodes: results built on the way may be wrong, drop them all and retry
+    hash->full = 0;
+    hash->root = root;
+    hash->origin_row = origin_row;
+    hash->origin_col = origin_col;
+    life_hash_collect(hash, 0);
+    if (hash_advance_once(hash, log2_gens) == 0) return 0;
+
+    hash->full = 0;
+    hash->root = root;
+    hash->origin_row = origin_row;
+    hash->origin_col = origin_col;
+    life_hash_collect(hash, 0);
+    if (log2_gens == 0) return -1;
+
+    // Still too big: two jumps of half the size
+    if (life_hash_advance(hash, log2_gens - 1) != 0) return -1;
+    return life_hash_advance(hash, log2_gens - 1);
+}
+
+/**
+ * @brief Mark node n and everything reachable from it.
+ */
+static void hash_mark(life_hash_t *hash, life_node_t n, int keep_results) {
+    life_hash_node_t *node = &hash->nodes[n];
+    if (node->flags & HASH_MARK) return;
+    node->flags |= HASH_MARK;
+    if (node->level == 0) return;
+
+    for (int q = 0; q < 4; q++) hash_mark(hash, node->child[q], keep_results);
+    if (keep_results) {
+        if (node->result != LIFE_HASH_NONE) hash_mark(hash, node->result, keep_results);
+        if (node->step   != LIFE_HASH_NONE) hash_mark(hash, node->step, keep_results);
+    }
+}
+
+void life_hash_collect(life_hash_t *hash, int keep_results) {
+    for (size_t i = 0; i < hash->count; i++) {
+        hash->nodes[i].flags &= (uint8_t)~HASH_MARK;
+        if (!keep_results) hash->nodes[i].result = hash->nodes[i].step = LIFE_HASH_NONE;
+    }
+
+    hash_mark(hash, hash->root, keep_results);
+    for (int level = 0; level <= LIFE_HASH_MAX_LEVEL; level++) {
+        hash_mark(hash, hash->empty[level], keep_results);
+    }
+
+    // Sweep: survivors go back into the hash chains, the rest into the free list
+    memset(hash->bucket, 0xFF, hash->capacity * sizeof(life_node_t));
+    hash->free_list = LIFE_HASH_NONE;
+    hash->live = 2;
+    for (size_t i = hash->count; i-- > 2;) {
+        life_hash_node_t *node = &hash->nodes[i];
+        if ((node->flags & HASH_LIVE) && (node->flags & HASH_MARK)) {
+            size_t b = hash_key(node->child[0], node->child[1], node->child[2], node->child[3]) &
+                       (hash->capacity - 1);
+            node->next = hash->bucket[b];
+            hash->bucket[b] = (life_node_t)i;
+            hash->live++;
+        } else {
+            node->flags = 0;
+            node->result = node->step = LIFE_HASH_NONE;
+            node->next = hash->free_list;
+            hash->free_list = (life_node_t)i;
+        }
+    }
+    hash->collections++;
+}
+
+/* ********************************************************************************************* */
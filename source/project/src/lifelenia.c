@@ -0,0 +1,323 @@
+//    _____      _     ___        __                   _                    
+//   |_   _|    (_)  .' ..]      [  |                 (_)                   
+//     | |      __  _| |_  .---.  | | .---.  _ .--.   __   ,--.      .---.  
+//     | |   _ [  |'-| |-'/ /__\\ | |/ /__\\[ `.-. | [  | `'_\ :    / /'`\] 
+//    _| |__/ | | |  | |  | \__., | || \__., | | | |  | | // | |, _ | \__.  
+//   |________|[___][___]  '.__.'[___]'.__.'[___||__][___]\'-;__/(_)'.___.' 
+//                                                                          
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "life.h"
+#include "lifelenia.h"
+
+/* ********************************************************************************************* */
+
+int life_lenia_parse_rule(const char *text, life_lenia_rule_t *rule) {
+    life_lenia_rule_t r;
+    const char *p = text;
+    char *end;
+
+    // R<radius>,T<steps>,M<mu>,S<sigma>, in this order
+    if (toupper((unsigned char)*p++) != 'R') return -1;
+    long radius = strtol(p, &end, 10);
+    if (end == p || *end != ',') return -1;
+    p = end + 1;
+
+    if (toupper((unsigned char)*p++) != 'T') return -1;
+    long steps = strtol(p, &end, 10);
+    if (end == p || *end != ',') return -1;
+    p = end + 1;
+
+    if (toupper((unsigned char)*p++) != 'M') return -1;
+    r.mu = strtod(p, &end);
+    if (end == p || *end != ',') return -1;
+    p = end + 1;
+
+    if (toupper((unsigned char)*p++) != 'S') return -1;
+    r.sigma = strtod(p, &end);
+    if (end == p || *end != '\0') return -1;
+
+    if (radius < 1 || radius > LIFE_LENIA_MAX_RADIUS || steps < 1 || steps > 1000 ||
+        !(r.mu > 0.0 && r.mu <= 1.0) || !(r.sigma > 0.0 && r.sigma <= 1.0)) {
+        return -1;
+    }
+    r.radius = (int)radius;
+    r.steps  = (int)steps;
+
+    *rule = r;
+    return 0;
+}
+
+void life_lenia_format_rule(const life_lenia_rule_t *rule, char *buf) {
+    sprintf(buf, "R%d,T%d,M%g,S%g", rule->radius, rule->steps, rule->mu, rule->sigma);
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief z * i, without the __muldc3 call of the complex `*` operator.
+ */
+static inline double complex lenia_times_i(double complex z) {
+    return -cimag(z) + creal(z) * I;
+}
+
+/**
+ * @brief In-place iterative radix-2 FFT of n (power of two) complex values.
+ *
+ * @param roots n/2 twiddle factors exp(-2πik/n), or their conjugates for the
+ *              inverse transform (which is then not scaled by 1/n).
+ */
+static void lenia_fft(double complex *z, int n, const double complex *roots) {
+    // Bit-reversal permutation
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j |= bit;
+        if (i < j) {
+            double complex t = z[i];
+            z[i] = z[j];
+            z[j] = t;
+        }
+    }
+
+    // Butterflies of length 2, 4, ..., n
+    for (int len = 2; len <= n; len <<= 1) {
+        int half = len >> 1, step = n / len;
+        for (int i = 0; i < n; i += len) {
+            for (int k = 0; k < half; k++) {
+                // Product spelled out: the complex `*` operator calls __muldc3 for its
+                // NaN/infinity rules, several times slower than the four products
+                double complex w = roots[k * step], x = z[i + k + half];
+                double complex u = z[i + k];
+                double complex v = (creal(x) * creal(w) - cimag(x) * cimag(w))
+                                 + (creal(x) * cimag(w) + cimag(x) * creal(w)) * I;
+                z[i + k]        = u + v;
+                z[i + k + half] = u - v;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Row pass of the forward 2D FFT: half spectrum of every row into lenia->spectrum.
+ *
+ * Rows of `src` beyond `src_rows` and columns beyond `src_cols` are zero.
+ * Two real rows a and b go through one complex FFT as a + ib; their
+ * spectra are separated with the symmetry of real transforms:
+ * A[k] = (Z[k] + conj(Z[-k])) / 2 and B[k] = (Z[k] - conj(Z[-k])) / 2i.
+ */
+static void lenia_rows_forward(life_lenia_t *lenia, const float *src, int src_rows, int src_cols) {
+    const int width = lenia->width, half = width / 2 + 1;
+    double complex *line = lenia->line;
+
+    for (int r = 0; r < lenia->block; r += 2) {
+        const float *a = r < src_rows ? src + (size_t)r * src_cols : NULL;
+        const float *b = r + 1 < src_rows ? src + (size_t)(r + 1) * src_cols : NULL;
+        for (int x = 0; x < src_cols; x++) {
+            line[x] = (a ? a[x] : 0.0f) + (b ? b[x] : 0.0f) * I;
+        }
+        for (int x = src_cols; x < width; x++) line[x] = 0.0;
+
+        lenia_fft(line, width, lenia->roots);
+
+        double complex *sa = lenia->spectrum + (size_t)r * half;
+        double complex *sb = sa + half;
+        for (int k = 0; k < half; k++) {
+            double complex zk = line[k];
+            double complex zn = conj(line[(width - k) & (width - 1)]);
+            sa[k] = 0.5 * (zk + zn);
+            sb[k] = -0.5 * lenia_times_i(zk - zn);
+        }
+    }
+}
+
+/**
+ * @brief Column pass: forward FFT of every column of the half spectrum, then,
+ *        with `kernel`, multiplication by it and inverse FFT of the column.
+ */
+static void lenia_columns(life_lenia_t *lenia, const double *kernel) {
+    const int block = lenia->block, half = lenia->width / 2 + 1;
+    const double complex *roots   = lenia->roots + lenia->width;
+    const double complex *inverse = roots + block / 2;
+    double complex *line = lenia->line;
+
+    for (int k = 0; k < half; k++) {
+        for (int r = 0; r < block; r++) line[r] = lenia->spectrum[(size_t)r * half + k];
+        lenia_fft(line, block, roots);
+        if (kernel) {
+            for (int r = 0; r < block; r++) line[r] *= kernel[(size_t)r * half + k];
+            lenia_fft(line, block, inverse);
+        }
+        for (int r = 0; r < block; r++) lenia->spectrum[(size_t)r * half + k] = line[r];
+    }
+}
+
+/**
+ * @brief Row pass of the inverse 2D FFT for rows r and r+1 of the block.
+ *
+ * Rebuilds the full spectra of both (real) rows from their halves, packs
+ * them as A + iB into one inverse FFT and leaves row r in the real parts and
+ * row r+1 in the imaginary parts of lenia->line.
+ */
+static void lenia_rows_inverse(life_lenia_t *lenia, int r) {
+    const int width = lenia->width, half = width / 2 + 1;
+    const double complex *sa = lenia->spectrum + (size_t)r * half;
+    const double complex *sb = sa + half;
+    double complex *line = lenia->line;
+
+    for (int k = 0; k < half; k++) line[k] = sa[k] + lenia_times_i(sb[k]);
+    for (int k = half; k < width; k++) line[k] = conj(sa[width - k]) + lenia_times_i(conj(sb[width - k]));
+
+    lenia_fft(line, width, lenia->roots + width / 2);
+}
+
+/* ********************************************************************************************* */
+
+life_lenia_t* life_lenia_create(const char *buf, int rows, int cols, int pitch, const life_lenia_rule_t *rule) {
+    life_lenia_t *lenia = calloc(1, sizeof(life_lenia_t));
+    if (!lenia) return NULL;
+
+    const int radius = rule->radius;
+    lenia->rule   = *rule;
+    lenia->rows   = rows;
+    lenia->cols   = cols;
+    lenia->radius = radius;
+
+    // Blocks of at least 8R rows keep the 2R overlap rows under a quarter of the work;
+    // a slab shorter than that is a single block. Columns need R zeros of padding
+    // so that the circular convolution never wraps real columns onto each other.
+    int target = 64;
+    while (target < 8 * radius) target <<= 1;
+    int block = 2;
+    while (block < rows + 2 * radius && block < target) block <<= 1;
+    int width = 2;
+    while (width < cols + radius) width <<= 1;
+    lenia->block = block;
+    lenia->width = width;
+
+    const int half = width / 2 + 1;
+    size_t cells = (size_t)(rows + 2 * radius) * cols;
+    lenia->cell     = calloc(cells, sizeof(float));
+    lenia->next     = calloc(cells, sizeof(float));
+    lenia->kernel   = malloc((size_t)block * half * sizeof(double));
+    lenia->spectrum = malloc((size_t)block * half * sizeof(double complex));
+    lenia->line     = malloc((size_t)(block > width ? block : width) * sizeof(double complex));
+    lenia->roots    = malloc((size_t)(width + block) * sizeof(double complex));
+    float *grid     = calloc((size_t)block * width, sizeof(float));
+    if (!lenia->cell || !lenia->next || !lenia->kernel || !lenia->spectrum || !lenia->line ||
+        !lenia->roots || !grid) {
+        free(grid);
+        life_lenia_destroy(lenia);
+        return NULL;
+    }
+
+    // Twiddle factors of the row (width) and column (block) transforms, forward then inverse
+    const double pi = acos(-1.0);
+    for (int k = 0; k < width / 2; k++) {
+        lenia->roots[k]             = cexp(-2.0 * pi * I * k / width);
+        lenia->roots[width / 2 + k] = conj(lenia->roots[k]);
+    }
+    for (int k = 0; k < block / 2; k++) {
+        lenia->roots[width + k]             = cexp(-2.0 * pi * I * k / block);
+        lenia->roots[width + block / 2 + k] = conj(lenia->roots[width + k]);
+    }
+
+    // Alive cells of the byte board start at state 1
+    for (int i = 0; i < rows; i++) {
+        const char *src = buf + (size_t)(i + 1) * pitch + 1;
+        float *dst      = lenia->cell + (size_t)(i + radius) * cols;
+        for (int j = 0; j < cols; j++) dst[j] = (float)src[j];
+    }
+
+    // Ring kernel centred on (0, 0) of the circular block × width grid, normalized to sum 1
+    double sum = 0.0;
+    for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+            double d = sqrt((double)(dy * dy + dx * dx)) / radius;
+            double k = (d > 0.0 && d < 1.0) ? exp(4.0 - 1.0 / (d * (1.0 - d))) : 0.0;
+            grid[(size_t)((dy + block) % block) * width + (dx + width) % width] = (float)k;
+            sum += (float)k;
+        }
+    }
+
+    // Its spectrum is real (the kernel is symmetric); the 1/(block*width) of the
+    // inverse transforms is folded in, so the potential needs no extra scaling
+    lenia_rows_forward(lenia, grid, block, width);
+    lenia_columns(lenia, NULL);
+    for (size_t n = 0; n < (size_t)block * half; n++) {
+        lenia->kernel[n] = creal(lenia->spectrum[n]) / (sum * block * width);
+    }
+
+    free(grid);
+    return lenia;
+}
+
+void life_lenia_destroy(life_lenia_t *lenia) {
+    if (lenia) {
+        free(lenia->cell);
+        free(lenia->next);
+        free(lenia->kernel);
+        free(lenia->spectrum);
+        free(lenia->line);
+        free(lenia->roots);
+        free(lenia);
+    }
+}
+
+void life_step_lenia(life_lenia_t *lenia, life_stats_t *stats) {
+    const int rows = lenia->rows, cols = lenia->cols, radius = lenia->radius;
+    const int valid = lenia->block - 2 * radius;   // rows of potential per block
+    const double dt = 1.0 / lenia->rule.steps;
+    const double mu = lenia->rule.mu;
+    const double inv_two_var = 1.0 / (2.0 * lenia->rule.sigma * lenia->rule.sigma);
+    long alive = 0, births = 0, deaths = 0, moved = 0;
+
+    // Overlap-save: block b reads buffer rows r0 .. r0+block-1 (real rows r0-R ..),
+    // its rows R .. R+valid-1 only depend on rows inside the block
+    for (int r0 = 0; r0 < rows; r0 += valid) {
+        int out_rows = rows - r0 < valid ? rows - r0 : valid;
+
+        lenia_rows_forward(lenia, lenia->cell + (size_t)r0 * cols, rows + 2 * radius - r0, cols);
+        lenia_columns(lenia, lenia->kernel);
+
+        // Inverse row pairs (even, odd) covering block rows R .. R+out_rows-1
+        for (int r = radius & ~1; r < radius + out_rows; r += 2) {
+            lenia_rows_inverse(lenia, r);
+
+            for (int half = 0; half < 2; half++) {
+                int b = r + half;
+                if (b < radius || b >= radius + out_rows) continue;
+
+                size_t base      = (size_t)(r0 + b) * cols;
+                const float *cur = lenia->cell + base;
+                float *out       = lenia->next + base;
+                for (int j = 0; j < cols; j++) {
+                    double u = half ? cimag(lenia->line[j]) : creal(lenia->line[j]);
+                    double g = 2.0 * exp(-(u - mu) * (u - mu) * inv_two_var) - 1.0;
+                    double a = cur[j] + dt * g;
+                    float state = (float)(a < 0.0 ? 0.0 : a > 1.0 ? 1.0 : a);
+                    out[j] = state;
+
+                    alive  += state > 0.0f;
+                    births += (state > 0.0f) & (cur[j] == 0.0f);
+                    deaths += (state == 0.0f) & (cur[j] > 0.0f);
+                    moved  += state != cur[j];
+                }
+            }
+        }
+    }
+
+    float *tmp  = lenia->cell;
+    lenia->cell = lenia->next;
+    lenia->next = tmp;
+
+    stats->alive   = alive;
+    stats->births  = births;
+    stats->deaths  = deaths;
+    stats->changed = moved > 0;
+}
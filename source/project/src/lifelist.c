@@ -0,0 +1,176 @@
+//    _____      _     ___        __    _          _             
+//   |_   _|    (_)  .' ..]      [  |  (_)        / |_           
+//     | |      __  _| |_  .---.  | |  __   .--. `| |-'   .---.  
+//     | |   _ [  |'-| |-'/ /__\\ | | [  | ( (`\] | |    / /'`\] 
+//    _| |__/ | | |  | |  | \__., | |  | |  `'.'. | |, _ | \__.  
+//   |________|[___][___]  '.__.'[___][___][\__) )\__/(_)'.___.' 
+//                                                               
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include "lifelist.h"
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Make room for `needed` entries in the cell array (grows geometrically).
+ */
+static int list_reserve(life_list_t *list, size_t needed) {
+    if (needed <= list->capacity) return 0;
+
+    size_t capacity = list->capacity ? list->capacity : 1024;
+    while (capacity < needed) capacity *= 2;
+    int *cell = realloc(list->cell, capacity * sizeof(int));
+    if (!cell) return -1;
+    list->cell     = cell;
+    list->capacity = capacity;
+    return 0;
+}
+
+life_list_t* life_list_create(const char *buf, int rows, int cols, int pitch) {
+    life_list_t *list = calloc(1, sizeof(life_list_t));
+    if (!list) return NULL;
+
+    list->rows      = rows;
+    list->cols      = cols;
+    list->start     = calloc((size_t)rows + 1, sizeof(size_t));
+    list->ghost[0]  = malloc((size_t)cols * sizeof(int));
+    list->ghost[1]  = malloc((size_t)cols * sizeof(int));
+    list->merge_col = malloc((size_t)cols * sizeof(int));
+    list->merge_w   = malloc((size_t)cols);
+    if (!list->start || !list->ghost[0] || !list->ghost[1] || !list->merge_col || !list->merge_w ||
+        list_reserve(list, 1024) != 0) {
+        life_list_destroy(list);
+        return NULL;
+    }
+
+    if (buf) {
+        size_t count = 0;
+        for (int i = 0; i < rows; i++) {
+            const char *row = buf + (size_t)(i + 1) * pitch + 1;
+            list->start[i] = count;
+            for (int j = 0; j < cols; j++) {
+                if (!row[j]) continue;
+                if (list_reserve(list, count + 1) != 0) {
+                    life_list_destroy(list);
+                    return NULL;
+                }
+                list->cell[count++] = j;
+            }
+        }
+        list->start[rows] = count;
+    }
+    return list;
+}
+
+void life_list_destroy(life_list_t *list) {
+    if (list) {
+        free(list->start);
+        free(list->cell);
+        free(list->ghost[0]);
+        free(list->ghost[1]);
+        free(list->merge_col);
+        free(list->merge_w);
+        free(list);
+    }
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Merge three sorted column lists into distinct columns with their alive count.
+ *
+ * merge_w[k] is the number of the three rows alive at merge_col[k], plus 4
+ * if the middle row (b) is alive there.
+ *
+ * @return Number of distinct columns.
+ */
+static int list_merge(const int *a, int na, const int *b, int nb, const int *c, int nc,
+                      int *merge_col, unsigned char *merge_w) {
+    int ia = 0, ib = 0, ic = 0, m = 0;
+    while (ia < na || ib < nb || ic < nc) {
+        int col = ia < na ? a[ia] : INT_MAX;
+        if (ib < nb && b[ib] < col) col = b[ib];
+        if (ic < nc && c[ic] < col) col = c[ic];
+
+        unsigned char w = 0;
+        if (ia < na && a[ia] == col) { w += 1; ia++; }
+        if (ib < nb && b[ib] == col) { w += 5; ib++; }
+        if (ic < nc && c[ic] == col) { w += 1; ic++; }
+        merge_col[m] = col;
+        merge_w[m]   = w;
+        m++;
+    }
+    return m;
+}
+
+int life_step_list(const life_list_t *current, life_list_t *next, life_stats_t *stats) {
+    const unsigned rule = life_get_rule();
+    int rows = current->rows, cols = current->cols;
+    long alive = 0, births = 0, deaths = 0;
+    size_t count = 0;
+
+    for (int i = 0; i < rows; i++) {
+        const int *above, *row, *below;
+        int n_above, n_row, n_below;
+
+        // Rows above/below the slab come from the ghost rows
+        if (i == 0) {
+            above = current->ghost[0];  n_above = current->ghost_count[0];
+        } else {
+            above = current->cell + current->start[i - 1];  n_above = (int)(current->start[i] - current->start[i - 1]);
+        }
+        row = current->cell + current->start[i];  n_row = (int)(current->start[i + 1] - current->start[i]);
+        if (i == rows - 1) {
+            below = current->ghost[1];  n_below = current->ghost_count[1];
+        } else {
+            below = current->cell + current->start[i + 1];  n_below = (int)(current->start[i + 2] - current->start[i + 1]);
+        }
+
+        next->start[i] = count;
+        if (n_above + n_row + n_below == 0) continue;
+
+        int m = list_merge(above, n_above, row, n_row, below, n_below, next->merge_col, next->merge_w);
+        const int *mc = next->merge_col;
+        const unsigned char *mw = next->merge_w;
+
+        // At most three candidates per merged column, and never more than cols
+        size_t bound = (size_t)3 * m < (size_t)cols ? (size_t)3 * m : (size_t)cols;
+        if (list_reserve(next, count + bound) != 0) return -1;
+        int *out = next->cell;
+
+        // Candidates are the columns next to a merged one, visited once in increasing order
+        int last = -2, lo = 0;
+        for (int k = 0; k < m; k++) {
+            int from = mc[k] - 1 > last + 1 ? mc[k] - 1 : last + 1;
+            int to   = mc[k] + 1;
+            if (from < 0) from = 0;
+            if (to > cols - 1) to = cols - 1;
+
+            for (int x = from; x <= to; x++) {
+                // Window of merged columns x-1 .. x+1 (at most three entries)
+                while (mc[lo] < x - 1) lo++;
+                int total = 0, self = 0;
+                for (int j = lo; j < m && mc[j] <= x + 1; j++) {
+                    total += mw[j] & 3;
+                    if (mc[j] == x) self = mw[j] >> 2;
+                }
+                int alive_neighbors = total - self;
+                int is_alive = (int)LIFE_RULE_NEXT(rule, self, alive_neighbors);
+
+                if (is_alive) out[count++] = x;
+                alive  += is_alive;
+                births += is_alive && !self;
+                deaths += self && !is_alive;
+            }
+            if (to > last) last = to;
+        }
+    }
+    next->start[rows] = count;
+
+    life_stats_set(stats, alive, births, deaths);
+    return 0;
+}
+
+/* ********************************************************************************************* */
@@ -0,0 +1,218 @@
+//    _____      _     ___        __   _   __             
+//   |_   _|    (_)  .' ..]      [  | / |_[  |            
+//     | |      __  _| |_  .---.  | |`| |-'| |     .---.  
+//     | |   _ [  |'-| |-'/ /__\\ | | | |  | |    / /'`\] 
+//    _| |__/ | | |  | |  | \__., | | | |, | |  _ | \__.  
+//   |________|[___][___]  '.__.'[___]\__/[___](_)'.___.' 
+//                                                        
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "life.h"
+#include "lifeltl.h"
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Read a non-negative decimal number at *p and advance past it.
+ *
+ * @return The number, or -1 if *p does not start with a digit (or it overflows).
+ */
+static int ltl_number(const char **p) {
+    if (!isdigit((unsigned char)**p)) return -1;
+
+    int value = 0;
+    while (isdigit((unsigned char)**p)) {
+        value = value * 10 + (**p - '0');
+        if (value > 1000000) return -1;
+        (*p)++;
+    }
+    return value;
+}
+
+/**
+ * @brief Read the field "<letter><a>..<b>" (range) at *p and advance past it.
+ *
+ * @return 0 on success, -1 if the field is malformed.
+ */
+static int ltl_range(const char **p, char letter, int *lo, int *hi) {
+    if (toupper((unsigned char)**p) != letter) return -1;
+    (*p)++;
+    *lo = ltl_number(p);
+    if (*lo < 0 || (*p)[0] != '.' || (*p)[1] != '.') return -1;
+    *p += 2;
+    *hi = ltl_number(p);
+    return *hi < 0 ? -1 : 0;
+}
+
+int life_ltl_parse_rule(const char *text, life_ltl_rule_t *rule) {
+    life_ltl_rule_t r = { 0, 0, 0, 0, 0, 0 };
+    const char *p = text;
+
+    // R<r> first, then the optional C<c> and M<m>
+    if (toupper((unsigned char)*p) != 'R') return -1;
+    p++;
+    r.radius = ltl_number(&p);
+    if (r.radius < 1 || r.radius > LIFE_LTL_MAX_RADIUS || *p++ != ',') return -1;
+
+    if (toupper((unsigned char)*p) == 'C') {
+        p++;
+        int states = ltl_number(&p);
+        if ((states != 0 && states != 2) || *p++ != ',') return -1;
+    }
+    if (toupper((unsigned char)*p) == 'M') {
+        p++;
+        r.middle = ltl_number(&p);
+        if ((r.middle != 0 && r.middle != 1) || *p++ != ',') return -1;
+    }
+
+    // S<a>..<b>,B<c>..<d>, then the optional ,N<n> (Moore only)
+    if (ltl_range(&p, 'S', &r.survive_min, &r.survive_max) != 0 || *p++ != ',') return -1;
+    if (ltl_range(&p, 'B', &r.birth_min, &r.birth_max) != 0) return -1;
+    if (*p == ',') {
+        p++;
+        if (toupper((unsigned char)p[0]) != 'N' || toupper((unsigned char)p[1]) != 'M') return -1;
+        p += 2;
+    }
+    if (*p != '\0') return -1;
+
+    // Counts range over 0..(2R+1)^2 (minus the cell itself without middle), min > max
+    // is an empty range; a birth count of 0 would turn the dead surroundings alive
+    int cells = (2 * r.radius + 1) * (2 * r.radius + 1) - !r.middle;
+    if (r.survive_max > cells || r.birth_min < 1 || r.birth_max > cells) {
+        return -1;
+    }
+
+    *rule = r;
+    return 0;
+}
+
+int life_ltl_from_rule(unsigned mask, life_ltl_rule_t *rule) {
+    life_ltl_rule_t r = { 1, 0, 1, 0, 1, 0 };   // radius 1, both ranges empty
+
+    // Each set of neighbor counts must be one contiguous run of bits (or empty)
+    for (int part = 0; part < 2; part++) {
+        unsigned bits = (mask >> (9 * part)) & 0x1FF;
+        int *lo = part ? &r.survive_min : &r.birth_min;
+        int *hi = part ? &r.survive_max : &r.birth_max;
+        if (!bits) continue;
+
+        int n = 0;
+        while (!((bits >> n) & 1)) n++;
+        *lo = n;
+        while ((bits >> n) & 1) n++;
+        *hi = n - 1;
+        if (bits >> n) return -1;
+    }
+
+    *rule = r;
+    return 0;
+}
+
+void life_ltl_format_rule(const life_ltl_rule_t *rule, char *buf) {
+    sprintf(buf, "R%d,C0,M%d,S%d..%d,B%d..%d,NM", rule->radius, rule->middle,
+            rule->survive_min, rule->survive_max, rule->birth_min, rule->birth_max);
+}
+
+life_ltl_t* life_ltl_create(const life_ltl_rule_t *rule, int cols) {
+    life_ltl_t *ltl = calloc(1, sizeof(life_ltl_t));
+    if (!ltl) return NULL;
+
+    int radius = rule->radius;
+
+    ltl->rule   = *rule;
+    ltl->cols   = cols;
+    ltl->colsum = malloc((size_t)cols * sizeof(int));
+    ltl->prefix = malloc((size_t)(cols + 2 * radius + 2) * sizeof(int));
+    if (!ltl->colsum || !ltl->prefix) {
+        life_ltl_destroy(ltl);
+        return NULL;
+    }
+    return ltl;
+}
+
+void life_ltl_destroy(life_ltl_t *ltl) {
+    if (ltl) {
+        free(ltl->colsum);
+        free(ltl->prefix);
+        free(ltl);
+    }
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Turn the range [min, max] into (lo, span) so that a count is in it iff
+ *        (unsigned)(count - lo) <= span: one compare per cell, no branch.
+ *
+ * An empty range (min > max) starts above the largest count, so the
+ * subtraction wraps to a huge value for every count.
+ */
+static void ltl_bounds(int min, int max, int radius, int *lo, unsigned *span) {
+    if (min > max) {
+        *lo   = (2 * radius + 1) * (2 * radius + 1) + 1;
+        *span = 0;
+    } else {
+        *lo   = min;
+        *span = (unsigned)(max - min);
+    }
+}
+
+void life_step_ltl(life_ltl_t *ltl, const char *current, char *next, int rows, int pitch,
+                   life_stats_t *stats) {
+    const int radius = ltl->rule.radius;
+    const int cols   = ltl->cols;
+    const int self   = !ltl->rule.middle;   // subtracted from the window sum without middle
+    int birth_lo, survive_lo;
+    unsigned birth_span, survive_span;
+    ltl_bounds(ltl->rule.birth_min, ltl->rule.birth_max, radius, &birth_lo, &birth_span);
+    ltl_bounds(ltl->rule.survive_min, ltl->rule.survive_max, radius, &survive_lo, &survive_span);
+    int *colsum = ltl->colsum;
+    int *prefix = ltl->prefix;
+    long alive = 0, births = 0, deaths = 0;
+
+    // Column sums of buffer rows 0..2R-1: the window of the first real row without its last row
+    memset(colsum, 0, (size_t)cols * sizeof(int));
+    for (int r = 0; r < 2 * radius; r++) {
+        const char *row = current + (size_t)r * pitch + 1;
+        for (int c = 0; c < cols; c++) colsum[c] += row[c];
+    }
+
+    // prefix[t] = colsum over columns 1..t-R-1 (clamped to the board), so that the
+    // window sum of column j (columns j-R..j+R) is prefix[j+2R+1] - prefix[j]
+    memset(prefix, 0, (size_t)(radius + 2) * sizeof(int));
+
+    for (int i = 0; i < rows; i++) {
+        // Slide the window down: add buffer row i+2R (row i+R of the slab)
+        const char *add = current + (size_t)(i + 2 * radius) * pitch + 1;
+        for (int c = 0; c < cols; c++) colsum[c] += add[c];
+
+        int *p = prefix + radius + 1;
+        for (int c = 0; c < cols; c++) p[c + 1] = p[c] + colsum[c];
+        for (int t = cols + 1; t <= cols + radius; t++) p[t] = p[cols];
+
+        const char *mid = current + (size_t)(i + radius) * pitch;
+        char *out       = next + (size_t)(i + radius) * pitch;
+        for (int j = 1; j <= cols; j++) {
+            char is_alive  = mid[j];
+            int count      = prefix[j + 2 * radius + 1] - prefix[j] - self * is_alive;
+            int lo         = is_alive ? survive_lo : birth_lo;
+            unsigned span  = is_alive ? survive_span : birth_span;
+            char new_state = (char)((unsigned)(count - lo) <= span);
+            out[j] = new_state;
+
+            alive  += new_state;
+            births += new_state & !is_alive;
+            deaths += is_alive & !new_state;
+        }
+
+        // Drop buffer row i (row i-R of the slab), which leaves the window of the next row
+        const char *drop = current + (size_t)i * pitch + 1;
+        for (int c = 0; c < cols; c++) colsum[c] -= drop[c];
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
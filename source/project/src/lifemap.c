@@ -0,0 +1,150 @@
+//    _____      _     ___                                             
+//   |_   _|    (_)  .' ..]                                            
+//     | |      __  _| |_  .---.  _ .--..--.   ,--.  _ .--.     .---.  
+//     | |   _ [  |'-| |-'/ /__\\[ `.-. .-. | `'_\ :[ '/'`\ \  / /'`\] 
+//    _| |__/ | | |  | |  | \__., | | | | | | // | |,| \__/ |_ | \__.  
+//   |________|[___][___]  '.__.'[___||__||__]\'-;__/| ;.__/(_)'.___.' 
+//                                                  [__|               
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "lifemap.h"
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Map a new unlinked, sparse file of `bytes` bytes from `dir` (NULL on failure).
+ */
+static char *life_map_file(const char *dir, size_t bytes) {
+    char path[4096];
+    if (snprintf(path, sizeof(path), "%s/life-map-XXXXXX", dir) >= (int)sizeof(path)) return NULL;
+
+    int fd = mkstemp(path);
+    if (fd < 0) return NULL;
+    unlink(path);
+
+    void *cells = MAP_FAILED;
+    if (ftruncate(fd, (off_t)bytes) == 0) {
+        cells = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);  // the mapping keeps the file alive
+    if (cells == MAP_FAILED) return NULL;
+
+    // Every generation goes through the file front to back
+    madvise(cells, bytes, MADV_SEQUENTIAL);
+    return cells;
+}
+
+/**
+ * @brief madvise() the whole pages inside [from, to) of a mapping, and move *from forward.
+ *
+ * Pages are only advised once: *from is left at the first byte not covered,
+ * so that a page shared by two bands goes with the second one.
+ */
+static void life_map_advise(char *cells, size_t *from, size_t to, int advice) {
+    size_t page  = (size_t)sysconf(_SC_PAGESIZE);
+    size_t first = (*from + page - 1) / page * page;
+    size_t last  = to / page * page;
+    if (last > first) {
+        madvise(cells + first, last - first, advice);
+        *from = last;
+    }
+}
+
+/**
+ * @brief Map in advance the pages of [from, to) of a mapping (whole pages around the range).
+ *
+ * Faulting the pages of a band one by one costs more than computing it once
+ * the file is cached, so they are populated in one call where the kernel
+ * supports it (Linux 5.14+); elsewhere this is a no-op and pages fault in
+ * as they are touched.
+ */
+static void life_map_populate(char *cells, size_t from, size_t to, int write) {
+#if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+    size_t page  = (size_t)sysconf(_SC_PAGESIZE);
+    size_t first = from / page * page;
+    madvise(cells + first, to - first, write ? MADV_POPULATE_WRITE : MADV_POPULATE_READ);
+#else
+    (void)cells;
+    (void)from;
+    (void)to;
+    (void)write;
+#endif
+}
+
+life_map_t *life_map_create(int rows, int cols, const char *dir) {
+    if (!dir) dir = getenv("TMPDIR");
+    if (!dir || !*dir) dir = "/tmp";
+
+    life_map_t *map = calloc(1, sizeof(*map));
+    if (!map) return NULL;
+
+    map->rows  = rows;
+    map->cols  = cols;
+    map->pitch = life_pitch(cols);
+    map->band  = LIFE_MAP_BAND_BYTES / map->pitch > 0 ? LIFE_MAP_BAND_BYTES / map->pitch : 1;
+    map->bytes = (size_t)(rows + 2) * map->pitch;
+
+    // Finished bands are only dropped when both generations would crowd the RAM
+    long pages = sysconf(_SC_PHYS_PAGES), page = sysconf(_SC_PAGESIZE);
+    map->release = pages <= 0 || page <= 0 || 2 * map->bytes > (size_t)pages * (size_t)page / 2;
+
+    map->current = life_map_file(dir, map->bytes);
+    map->next    = life_map_file(dir, map->bytes);
+    if (!map->current || !map->next) {
+        life_map_destroy(map);
+        return NULL;
+    }
+    return map;
+}
+
+void life_map_destroy(life_map_t *map) {
+    if (!map) return;
+    if (map->current) munmap(map->current, map->bytes);
+    if (map->next)    munmap(map->next, map->bytes);
+    free(map);
+}
+
+void life_step_map(life_map_t *map, life_stats_t *stats) {
+    const size_t pitch = (size_t)map->pitch;
+    size_t read_done = 0, write_done = 0, ahead_done = 0;
+    long alive = 0, births = 0, deaths = 0;
+
+    for (int r0 = 0; r0 < map->rows; r0 += map->band) {
+        int n = map->rows - r0 < map->band ? map->rows - r0 : map->band;
+
+        // Fetch the rows of the next band (up to its row below) while this one is computed
+        if (r0 + n < map->rows) {
+            int ahead = map->rows - r0 - n < map->band ? map->rows - r0 - n : map->band;
+            if (ahead_done < (r0 + n + 1) * pitch) ahead_done = (r0 + n + 1) * pitch;
+            life_map_advise(map->current, &ahead_done, (r0 + n + ahead + 2) * pitch, MADV_WILLNEED);
+        }
+
+        // Band rows r0+1..r0+n read current rows r0..r0+n+1
+        life_map_populate(map->current, r0 * pitch, (r0 + n + 2) * pitch, 0);
+        life_map_populate(map->next, (r0 + 1) * pitch, (r0 + n + 1) * pitch, 1);
+        life_stats_t band;
+        life_step(map->current + r0 * pitch, map->next + r0 * pitch, n, map->cols, map->pitch, &band);
+        alive  += band.alive;
+        births += band.births;
+        deaths += band.deaths;
+
+        // Later bands only read current from row r0+n and write next from row r0+n+1
+        if (map->release) {
+            life_map_advise(map->current, &read_done, (r0 + n) * pitch, MADV_DONTNEED);
+            life_map_advise(map->next, &write_done, (r0 + n + 1) * pitch, MADV_DONTNEED);
+        }
+    }
+
+    char *tmp    = map->current;
+    map->current = map->next;
+    map->next    = tmp;
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/* ********************************************************************************************* */
@@ -0,0 +1,227 @@
+//    _____      _     ___                                    _                              
+//   |_   _|    (_)  .' ..]                                  / |_                            
+//     | |      __  _| |_  .---.  _ .--..--.  .--.    _ .--.`| |-'.--.    _ .--.      .---.  
+//     | |   _ [  |'-| |-'/ /__\\[ `.-. .-. |/ .'`\ \[ `/'`\]| | / .'`\ \[ `.-. |    / /'`\] 
+//    _| |__/ | | |  | |  | \__., | | | | | || \__. | | |    | |,| \__. | | | | |  _ | \__.  
+//   |________|[___][___]  '.__.'[___||__||__]'.__.' [___]   \__/ '.__.' [___||__](_)'.___.' 
+//                                                                                           
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lifemorton.h"
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Interleave the bits of (y, x): x in the even bits, y in the odd bits.
+ */
+static uint64_t morton_code(uint32_t y, uint32_t x) {
+    uint64_t c = 0;
+    for (int b = 0; b < 32; b++) {
+        c |= (uint64_t)((x >> b) & 1) << (2 * b);
+        c |= (uint64_t)((y >> b) & 1) << (2 * b + 1);
+    }
+    return c;
+}
+
+/**
+ * @brief Tile (row-major id) with its Morton code, sorted to assign the slots.
+ */
+typedef struct {
+    uint64_t code;
+    int tile;
+} morton_key_t;
+
+static int morton_key_cmp(const void *a, const void *b) {
+    uint64_t ca = ((const morton_key_t *)a)->code;
+    uint64_t cb = ((const morton_key_t *)b)->code;
+    return (ca > cb) - (ca < cb);
+}
+
+/**
+ * @brief Padded buffer of tile (ty, tx) in the tile storage.
+ */
+static inline char* morton_tile(const life_morton_t *m, int ty, int tx) {
+    return m->cells + (size_t)m->slot[ty * m->tiles_x + tx] * LIFE_MORTON_BYTES;
+}
+
+/**
+ * @brief Real rows of tile row ty (the last one may be partial).
+ */
+static inline int morton_height(const life_morton_t *m, int ty) {
+    int y0 = ty * LIFE_MORTON_TILE;
+    return m->rows - y0 < LIFE_MORTON_TILE ? m->rows - y0 : LIFE_MORTON_TILE;
+}
+
+/**
+ * @brief Real columns of tile column tx (the last one may be partial).
+ */
+static inline int morton_width(const life_morton_t *m, int tx) {
+    int x0 = tx * LIFE_MORTON_TILE;
+    return m->cols - x0 < LIFE_MORTON_TILE ? m->cols - x0 : LIFE_MORTON_TILE;
+}
+
+/* ********************************************************************************************* */
+
+life_morton_t* life_morton_create(const char *buf, int rows, int cols, int pitch) {
+    life_morton_t *m = calloc(1, sizeof(life_morton_t));
+    if (!m) return NULL;
+
+    int T = LIFE_MORTON_TILE;
+    m->rows    = rows;
+    m->cols    = cols;
+    m->tiles_y = (rows + T - 1) / T;
+    m->tiles_x = (cols + T - 1) / T;
+
+    // Page-aligned tile storage, zeroed (borders and cells outside the board dead)
+    int tiles = m->tiles_y * m->tiles_x;
+    size_t bytes = (size_t)tiles * LIFE_MORTON_BYTES;
+    void *cells = NULL;
+    if (posix_memalign(&cells, 4096, bytes) == 0) {
+        m->cells = cells;
+        memset(m->cells, 0, bytes);
+    }
+    m->slot  = malloc((size_t)tiles * sizeof(int));
+    m->order = malloc((size_t)tiles * sizeof(int));
+    morton_key_t *keys = malloc((size_t)tiles * sizeof(morton_key_t));
+    for (int g = 0; g < 2; g++) {
+        m->ghost[g] = calloc((size_t)cols + 2, 1);
+        m->edge[g]  = calloc((size_t)cols, 1);
+    }
+    if (!m->slot || !m->order || !m->cells || !keys ||
+        !m->ghost[0] || !m->edge[0] || !m->ghost[1] || !m->edge[1]) {
+        free(keys);
+        life_morton_destroy(m);
+        return NULL;
+    }
+
+    // Slots follow the Z-order of the tile coordinates (the grid need not be square or 2^k)
+    for (int t = 0; t < tiles; t++) {
+        keys[t].code = morton_code((uint32_t)(t / m->tiles_x), (uint32_t)(t % m->tiles_x));
+        keys[t].tile = t;
+    }
+    qsort(keys, (size_t)tiles, sizeof(morton_key_t), morton_key_cmp);
+    for (int s = 0; s < tiles; s++) {
+        m->order[s]           = keys[s].tile;
+        m->slot[keys[s].tile] = s;
+    }
+    free(keys);
+
+    // Copy the real rows tile by tile
+    if (buf) {
+        for (int i = 0; i < rows; i++) {
+            const char *row = buf + (size_t)(i + 1) * pitch + 1;
+            for (int tx = 0; tx < m->tiles_x; tx++) {
+                char *dst = morton_tile(m, i / T, tx) + (i % T + 1) * LIFE_MORTON_PITCH + 1;
+                memcpy(dst, row + tx * T, (size_t)morton_width(m, tx));
+            }
+        }
+    }
+    return m;
+}
+
+void life_morton_destroy(life_morton_t *morton) {
+    if (morton) {
+        free(morton->slot);
+        free(morton->order);
+        free(morton->cells);
+        for (int g = 0; g < 2; g++) {
+            free(morton->ghost[g]);
+            free(morton->edge[g]);
+        }
+        free(morton);
+    }
+}
+
+void life_morton_pack_edges(life_morton_t *morton) {
+    int T = LIFE_MORTON_TILE;
+    for (int g = 0; g < 2; g++) {
+        int y = g ? morton->rows - 1 : 0;
+        for (int tx = 0; tx < morton->tiles_x; tx++) {
+            const char *src = morton_tile(morton, y / T, tx) + (y % T + 1) * LIFE_MORTON_PITCH + 1;
+            memcpy(morton->edge[g] + tx * T, src, (size_t)morton_width(morton, tx));
+        }
+    }
+}
+
+long life_morton_count(const life_morton_t *morton) {
+    long count = 0;
+    for (int ty = 0; ty < morton->tiles_y; ty++) {
+        for (int tx = 0; tx < morton->tiles_x; tx++) {
+            const char *tile = morton_tile(morton, ty, tx);
+            for (int r = 1; r <= morton_height(morton, ty); r++) {
+                count += life_count(tile + r * LIFE_MORTON_PITCH + 1, morton_width(morton, tx));
+            }
+        }
+    }
+    return count;
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Copy into every tile border the cells of the adjacent tiles and ghost rows.
+ *
+ * Left/right border columns go first, so that the top/bottom border rows,
+ * copied as whole padded rows of the tiles above/below, carry the corners.
+ */
+static void morton_refresh(life_morton_t *m) {
+    int P = LIFE_MORTON_PITCH;
+
+    // 1. Left and right borders (rows 1..h) from the last/first real column of the neighbors
+    for (int ty = 0; ty < m->tiles_y; ty++) {
+        int h = morton_height(m, ty);
+        for (int tx = 0; tx < m->tiles_x; tx++) {
+            char *tile        = morton_tile(m, ty, tx);
+            int w             = morton_width(m, tx);
+            const char *left  = tx > 0              ? morton_tile(m, ty, tx - 1) + LIFE_MORTON_TILE : NULL;
+            const char *right = tx + 1 < m->tiles_x ? morton_tile(m, ty, tx + 1) + 1               : NULL;
+            for (int r = 1; r <= h; r++) {
+                tile[r * P]         = left  ? left[r * P]  : 0;
+                tile[r * P + w + 1] = right ? right[r * P] : 0;
+            }
+        }
+    }
+
+    // 2. Top and bottom borders (columns 0..w+1) from the tiles above/below or the ghost rows
+    for (int ty = 0; ty < m->tiles_y; ty++) {
+        int h = morton_height(m, ty);
+        for (int tx = 0; tx < m->tiles_x; tx++) {
+            char *tile = morton_tile(m, ty, tx);
+            size_t n   = (size_t)morton_width(m, tx) + 2;
+            const char *above = ty > 0
+                ? morton_tile(m, ty - 1, tx) + LIFE_MORTON_TILE * P
+                : m->ghost[0] + tx * LIFE_MORTON_TILE;
+            const char *below = ty + 1 < m->tiles_y
+                ? morton_tile(m, ty + 1, tx) + P
+                : m->ghost[1] + tx * LIFE_MORTON_TILE;
+            memcpy(tile, above, n);
+            memcpy(tile + (h + 1) * P, below, n);
+        }
+    }
+}
+
+void life_step_morton(life_morton_t *current, life_morton_t *next, life_stats_t *stats) {
+    morton_refresh(current);
+
+    // Tiles in storage (Z) order: every tile is a padded buffer the kernels understand
+    long alive = 0, births = 0, deaths = 0;
+    int tiles = current->tiles_y * current->tiles_x;
+    for (int s = 0; s < tiles; s++) {
+        int ty = current->order[s] / current->tiles_x;
+        int tx = current->order[s] % current->tiles_x;
+
+        life_stats_t tile_stats;
+        life_step(current->cells + (size_t)s * LIFE_MORTON_BYTES, next->cells + (size_t)s * LIFE_MORTON_BYTES,
+                  morton_height(current, ty), morton_width(current, tx), LIFE_MORTON_PITCH, &tile_stats);
+        alive  += tile_stats.alive;
+        births += tile_stats.births;
+        deaths += tile_stats.deaths;
+    }
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/* ********************************************************************************************* */
@@ -0,0 +1,300 @@
+//    _____      _     ___        _    _   __                   
+//   |_   _|    (_)  .' ..]      / |_ (_) [  |                  
+//     | |      __  _| |_  .---.`| |-'__   | | .---.     .---.  
+//     | |   _ [  |'-| |-'/ /__\\| | [  |  | |/ /__\\   / /'`\] 
+//    _| |__/ | | |  | |  | \__.,| |, | |  | || \__., _ | \__.  
+//   |________|[___][___]  '.__.'\__/[___][___]'.__.'(_)'.___.' 
+//                                                              
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "life.h"
+#include "lifetile.h"
+
+/* ********************************************************************************************* */
+
+static inline int tile_min(int a, int b) { return a < b ? a : b; }
+static inline int tile_max(int a, int b) { return a > b ? a : b; }
+
+/**
+ * @brief Alive cells of the h×w block at scratch row r0, column c0 (cells are 0/1).
+ */
+static long tile_count(const char *buf, int spitch, int r0, int c0, int h, int w) {
+    long alive = 0;
+    for (int k = 0; k < h; k++) {
+        const char *row = buf + (size_t)(r0 + k) * spitch + c0;
+        for (int j = 0; j < w; j++) {
+            alive += row[j];
+        }
+    }
+    return alive;
+}
+
+int life_step_tiled(const char *current, char *next, int rows, int cols, int pitch,
+                    int gens, int tile_rows, int tile_cols, life_stats_t *stats,
+                    long *gen_alive) {
+    // Two scratch tiles (ping-pong) holding a tile plus `gens` cells of overlap on each side
+    int max_cols = tile_min(cols, tile_cols + 2 * gens);
+    int spitch   = life_pitch(max_cols);
+    char *tile_a = life_alloc(tile_rows + 2 * gens, max_cols);
+    char *tile_b = life_alloc(tile_rows + 2 * gens, max_cols);
+    if (!tile_a || !tile_b) {
+        free(tile_a);
+        free(tile_b);
+        return -1;
+    }
+
+    long alive = 0, births = 0, deaths = 0;
+    if (gen_alive) {
+        memset(gen_alive, 0, (size_t)gens * sizeof(long));
+    }
+
+    for (int r0 = 0; r0 < rows; r0 += tile_rows) {
+        int th = tile_min(tile_rows, rows - r0);
+        int sh = th + 2 * gens;     // scratch rows: the tile and the halo rows above/below it
+
+        for (int c0 = 0; c0 < cols; c0 += tile_cols) {
+            int tw = tile_min(tile_cols, cols - c0);
+
+            // Board columns s0..s1-1 held by the scratch tile (clipped to the board)
+            int s0 = tile_max(0, c0 - gens);
+            int s1 = tile_min(cols, c0 + tw + gens);
+            int sw = s1 - s0;
+
+            // Copy in: slab rows r0-gens .. r0+th+gens-1 (buffer rows r0 ..) → scratch rows 1..sh.
+            // Scratch ghost columns are only read where the tile touches the board edge, so
+            // they must be dead; the tiles before may have left cells there, clear them
+            const char *src = current + (size_t)r0 * pitch + s0 + 1;
+            for (int k = 1; k <= sh; k++) {
+                char *dst = tile_a + (size_t)k * spitch;
+                dst[0] = dst[sw + 1] = 0;
+                tile_b[(size_t)k * spitch] = tile_b[(size_t)k * spitch + sw + 1] = 0;
+                memcpy(dst + 1, src + (size_t)(k - 1) * pitch, (size_t)sw);
+            }
+
+            // Advance the tile: after generation g only the tile grown by gens-g cells
+            // (on sides cut from a neighbor tile) is still exact, so compute just that
+            char *in  = tile_a;
+            char *out = tile_b;
+            for (int g = 1; g <= gens; g++) {
+                int margin = gens - g;
+                int x0 = tile_max(0, c0 - margin);
+                int x1 = tile_min(cols, c0 + tw + margin);
+                size_t offset = (size_t)g * spitch + (size_t)(x0 - s0);
+
+                life_stats_t tile_stats;
+                life_step(in + offset, out + offset, sh - 2 * g, x1 - x0, spitch, &tile_stats);
+
+                char *done = out;
+                out = in;
+                in  = done;
+
+                // The last generation covers exactly the tile; the earlier ones
+                // cover more, so only the tile's own cells count towards gen_alive
+                if (g == gens) {
+                    alive  += tile_stats.alive;
+                    births += tile_stats.births;
+                    deaths += tile_stats.deaths;
+                    if (gen_alive) gen_alive[g - 1] += tile_stats.alive;
+                } else if (gen_alive) {
+                    gen_alive[g - 1] += tile_count(in, spitch, gens + 1, (c0 - s0) + 1, th, tw);
+                }
+            }
+
+            // Copy out: the tile (scratch rows gens+1 .. gens+th) → slab rows r0 .. r0+th-1
+            for (int k = 0; k < th; k++) {
+                memcpy(next + (size_t)(gens + r0 + k) * pitch + c0 + 1,
+                       in + (size_t)(gens + 1 + k) * spitch + (c0 - s0) + 1, (size_t)tw);
+            }
+        }
+    }
+
+    free(tile_a);
+    free(tile_b);
+
+    life_stats_set(stats, alive, births, deaths);
+    return 0;
+}
+
+life_tiles_t* life_tiles_create(int rows, int cols, int tile_rows, int tile_cols) {
+    life_tiles_t *tiles = calloc(1, sizeof(life_tiles_t));
+    if (!tiles) return NULL;
+
+    tiles->rows      = rows;
+    tiles->cols      = cols;
+    tiles->tile_rows = tile_rows;
+    tiles->tile_cols = tile_cols;
+    tiles->tiles_y   = (rows + tile_rows - 1) / tile_rows;
+    tiles->tiles_x   = (cols + tile_cols - 1) / tile_cols;
+
+    size_t count      = (size_t)tiles->tiles_y * tiles->tiles_x;
+    tiles->changed    = calloc(count, sizeof(unsigned char));
+    tiles->dirty      = calloc(count, sizeof(unsigned char));
+    tiles->alive      = calloc(count, sizeof(long));
+    tiles->alive_prev = calloc(count, sizeof(long));
+    tiles->births     = calloc(count, sizeof(long));
+    tiles->deaths     = calloc(count, sizeof(long));
+    tiles->ghost      = calloc((size_t)4 * cols, sizeof(char));
+    tiles->border     = calloc((size_t)2 * tiles->tiles_x, sizeof(unsigned char));
+    if (!tiles->changed || !tiles->dirty || !tiles->alive || !tiles->alive_prev ||
+        !tiles->births || !tiles->deaths || !tiles->ghost || !tiles->border) {
+        life_tiles_destroy(tiles);
+        return NULL;
+    }
+    return tiles;
+}
+
+void life_tiles_destroy(life_tiles_t *tiles) {
+    if (tiles) {
+        free(tiles->changed);
+        free(tiles->dirty);
+        free(tiles->alive);
+        free(tiles->alive_prev);
+        free(tiles->births);
+        free(tiles->deaths);
+        free(tiles->ghost);
+        free(tiles->border);
+        free(tiles);
+    }
+}
+
+/**
+ * @brief Compare the ghost rows of this step with those of the last two steps.
+ *
+ * Fills tiles->border[side * tiles_x + x] with LIFE_TILE_CHANGED* flags for the
+ * segment of ghost row `side` (0: above, 1: below) over tile column x, then
+ * shifts the saved history (last → older, current → last).
+ */
+static void life_tiles_ghosts(life_tiles_t *tiles, const char *current, int pitch) {
+    const char *ghost_rows[2] = { current + 1, current + (size_t)(tiles->rows + 1) * pitch + 1 };
+
+    for (int side = 0; side < 2; side++) {
+        char *last  = tiles->ghost + (size_t)(2 * side) * tiles->cols;
+        char *older = last + tiles->cols;
+        for (int x = 0; x < tiles->tiles_x; x++) {
+            int c0 = x * tiles->tile_cols;
+            size_t tw = (size_t)tile_min(tiles->tile_cols, tiles->cols - c0);
+            const char *now = ghost_rows[side] + c0;
+
+            unsigned char flags = 0;
+            if (tiles->steps < 1 || memcmp(now, last + c0, tw) != 0)  flags |= LIFE_TILE_CHANGED1;
+            if (tiles->steps < 2 || memcmp(now, older + c0, tw) != 0) flags |= LIFE_TILE_CHANGED2;
+            tiles->border[side * tiles->tiles_x + x] = flags;
+
+            memcpy(older + c0, last + c0, tw);
+            memcpy(last + c0, now, tw);
+        }
+    }
+}
+
+/**
+ * @brief Mark the tiles to recompute in this generation.
+ *
+ * A tile can be skipped if neither flag is needed: all tiles of its 3×3
+ * neighborhood (and the ghost segments over those tile columns) are free of
+ * LIFE_TILE_CHANGED1, or all are free of LIFE_TILE_CHANGED2. Both flags are
+ * gathered over the same neighborhood, so a tile is neither left static nor
+ * frozen as period-2 while a ghost cell it reads changes. dirty[t] gets 0
+ * (skip), or the flags seen in the neighborhood (recompute).
+ */
+static void life_tiles_mark(life_tiles_t *tiles) {
+    int ty = tiles->tiles_y, tx = tiles->tiles_x;
+
+    for (int y = 0; y < ty; y++) {
+        for (int x = 0; x < tx; x++) {
+            unsigned char any = 0;
+            for (int ny = tile_max(0, y - 1); ny <= tile_min(ty - 1, y + 1); ny++) {
+                for (int nx = tile_max(0, x - 1); nx <= tile_min(tx - 1, x + 1); nx++) {
+                    any |= tiles->changed[ny * tx + nx];
+                }
+            }
+
+            // Edge tile rows also read the ghost cells c0-1 .. c0+tw, which reach into
+            // the segments over the neighboring tile columns
+            for (int nx = tile_max(0, x - 1); nx <= tile_min(tx - 1, x + 1); nx++) {
+                if (y == 0)      any |= tiles->border[nx];
+                if (y == ty - 1) any |= tiles->border[tx + nx];
+            }
+
+            unsigned char all = LIFE_TILE_CHANGED1 | LIFE_TILE_CHANGED2;
+            tiles->dirty[y * tx + x] = (tiles->steps == 0 || any == all) ? all : 0;
+        }
+    }
+}
+
+void life_step_active(life_tiles_t *tiles, const char *current, char *next, char *spare,
+                      int pitch, life_stats_t *stats) {
+    // Ghost history and change flags of the last step decide which tiles to compute
+    life_tiles_ghosts(tiles, current, pitch);
+    life_tiles_mark(tiles);
+
+    long alive = 0, births = 0, deaths = 0, computed = 0, frozen = 0;
+    int tx = tiles->tiles_x;
+
+    for (int y = 0; y < tiles->tiles_y; y++) {
+        int r0 = y * tiles->tile_rows;
+        int th = tile_min(tiles->tile_rows, tiles->rows - r0);
+
+        for (int x = 0; x < tx; x++) {
+            int t = y * tx + x;
+            long prev_alive = tiles->alive[t];
+
+            if (!tiles->dirty[t]) {
+                if (tiles->changed[t] & LIFE_TILE_CHANGED1) {
+                    // Frozen period-2 tile: g+1 is g-1, already in `next`;
+                    // its transitions are the last ones reversed
+                    long b = tiles->births[t];
+                    tiles->births[t] = tiles->deaths[t];
+                    tiles->deaths[t] = b;
+                    tiles->alive[t]  = tiles->alive_prev[t];
+                    tiles->changed[t] = LIFE_TILE_CHANGED1;
+                    frozen++;
+                } else {
+                    // Static tile: g+1 is g, and `next` holds g-1 == g
+                    tiles->births[t] = tiles->deaths[t] = 0;
+                    tiles->changed[t] = 0;
+                }
+            } else {
+                int c0 = x * tiles->tile_cols;
+                int tw = tile_min(tiles->tile_cols, tiles->cols - c0);
+                size_t offset = (size_t)r0 * pitch + (size_t)c0;
+
+                life_stats_t tile_stats;
+                life_step(current + offset, spare + offset, th, tw, pitch, &tile_stats);
+
+                // Compare with generation g-1 (still in `next`) and keep only real changes;
+                // a different population rules period 2 out without comparing
+                int period2 = tiles->steps > 0 && tile_stats.alive == tiles->alive_prev[t];
+                for (int i = 1; i <= th; i++) {
+                    char *dst       = next + offset + (size_t)i * pitch + 1;
+                    const char *src = spare + offset + (size_t)i * pitch + 1;
+                    if (!period2 || memcmp(dst, src, (size_t)tw) != 0) {
+                        memcpy(dst, src, (size_t)tw);
+                        period2 = 0;
+                    }
+                }
+
+                tiles->births[t]  = tile_stats.births;
+                tiles->deaths[t]  = tile_stats.deaths;
+                tiles->alive[t]   = tile_stats.alive;
+                tiles->changed[t] = (unsigned char)((tile_stats.changed ? LIFE_TILE_CHANGED1 : 0) |
+                                                    (period2 ? 0 : LIFE_TILE_CHANGED2));
+                computed++;
+            }
+
+            tiles->alive_prev[t] = prev_alive;
+            alive  += tiles->alive[t];
+            births += tiles->births[t];
+            deaths += tiles->deaths[t];
+        }
+    }
+
+    tiles->steps++;
+    tiles->computed = computed;
+    tiles->frozen   = frozen;
+
+    life_stats_set(stats, alive, births, deaths);
+}
+
+/* ********************************************************************************************* */
@@ -25,13 +25,132 @@
 #include <string.h>
 #include <mpi.h>
 #include "life.h"
+#include "lifecache.h"
+#include "lifedhash.h"
+#include "lifehash.h"
+#include "lifelenia.h"
+#include "lifelist.h"
+#include "lifeltl.h"
+#include "lifemap.h"
+#include "lifedelta.h"
+#include "lifemorton.h"
+#include "lifetile.h"
 #include "mpix.h"
 #include "utils.h"
 
 /* ********************************************************************************************* */
 
+/**
+ * @brief Cell representations available for the local slab.
+ */
+enum {
+    ENGINE_BYTE     = 0,  // one char per cell, life_step()
+    ENGINE_PACKED   = 1,  // one bit per cell in uint64_t words, life_step_packed()
+    ENGINE_LUT2     = 2,  // one char per cell, two generations per step, life_step2_lut()
+    ENGINE_TILED    = 3,  // one char per cell, T generations per cache-sized tile, life_step_tiled()
+    ENGINE_ACTIVE   = 4,  // one char per cell, static and period-2 tiles are skipped, life_step_active()
+    ENGINE_MEMO     = 5,  // one char per cell, 8×8 tiles looked up in an LRU cache, life_step_memo()
+    ENGINE_HASH     = 6,  // HashLife quadtree on MASTER, 2^k generations per jump (unbounded plane)
+    ENGINE_DHASH    = 7,  // HashLife quadtree hash-partitioned across all ranks, life_dhash_advance()
+    ENGINE_SPARSE   = 8,  // sorted alive columns per row, life_step_list() (cost follows the population)
+    ENGINE_DELTA    = 9,  // persistent neighbor counts updated from flips, life_step_delta() (cost follows activity)
+    ENGINE_INPLACE  = 10, // one char per cell, single buffer rewritten in place, life_step_inplace()
+    ENGINE_MORTON   = 11, // one char per cell in square tiles stored in Z-order, life_step_morton()
+    ENGINE_LTL      = 12, // one char per cell, range-R Larger-than-Life rules with R ghost rows, life_step_ltl()
+    ENGINE_LENIA    = 13, // one float per cell, Lenia rules, kernel convolution by FFT, life_step_lenia()
+    ENGINE_ENSEMBLE = 14, // one uint64_t per cell, bit k of every word is board k, life_step_ensemble()
+    ENGINE_GROW     = 15, // one char per cell, window of the unbounded plane refitted to the pattern, life_step()
+    ENGINE_MAP      = 16, // one char per cell in memory-mapped files, streamed in bands, life_step_map()
+    ENGINE_COUNT
+};
+
+static const char *ENGINE_NAMES[ENGINE_COUNT] = { "byte", "packed", "lut2", "tiled", "active", "memo", "hashlife",
+                                                  "dhashlife", "sparse", "delta", "inplace", "morton", "ltl",
+                                                  "lenia", "ensemble", "grow", "map" };
+
+/**
+ * @brief Default temporal depth T of the tiled engine (generations per exchange).
+ */
+#define DEFAULT_DEPTH 4
+
+/**
+ * @brief Default memory cap (MiB) of the HashLife node table (per rank for dhashlife).
+ */
+#define DEFAULT_MEMORY 1024
+
+/**
+ * @brief Early exit once the alive count repeats for this many consecutive generations.
+ */
+#define STABLE_THRESHOLD 10
+
+/**
+ * @brief Dead margin (rows or columns per side) the grow engine keeps around the live box,
+ *        on top of 1/8 of the box extent.
+ */
+#define GROW_MARGIN 16
+
+/**
+ * @brief Generations between two checks of the grow engine for a window much larger than the pattern.
+ */
+#define GROW_PERIOD 64
+
+/**
+ * @brief Local slab of the board as seen by the simulation loop.
+ *
+ * Wraps the two padded generations (current/next) of the selected engine so
+ * that the loop in main() does not depend on the cell representation.
+ */
+typedef struct {
+    int engine;         // ENGINE_* value
+    int local_rows;     // real rows owned by this rank
+    int cols;           // number of columns
+    int stride;         // elements per padded row (byte pitch, or packed words + 2)
+    int halo;           // ghost rows on each side of the slab
+    int gens;           // generations advanced per exchange/step
+    void *current;      // padded buffer holding the current generation (life_list_t of the sparse engine,
+                        // life_delta_t of the delta engine, life_morton_t of the morton engine,
+                        // life_lenia_t of the lenia engine, life_map_t of the map engine)
+    void *next;         // padded buffer receiving the next generation (life_list_t of the sparse engine,
+                        // life_morton_t of the morton engine, NULL for the delta, inplace, lenia and
+                        // map engines, which update in place or swap internally)
+    void *spare;        // third padded buffer of the active engine, row ring of the inplace engine
+                        // (NULL otherwise)
+    life_tiles_t *tiles;  // change tracking of the active engine (NULL otherwise)
+    life_memo_t *memo;    // tile cache of the memo engine (NULL otherwise)
+    life_ltl_t *ltl;      // rule table and window sums of the ltl engine (NULL otherwise)
+    life_window_t window; // part of the unbounded plane held by all ranks (grow engine only)
+    int boundary;         // LIFE_BOUNDARY_* value
+    long *gen_alive;      // alive cells after every generation of a step, local then global (2*gens
+                          // entries, lut2 and tiled engines only, NULL otherwise)
+} board_t;
+
+/* ********************************************************************************************* */
+
 static void print_usage(const char *prog_name);
-static int parse_args(int argc, char *argv[], int *rows, int *cols, int *epochs, int *user_seed);
+static int parse_args(int argc, char *argv[], int *rows, int *cols, int *epochs, int *user_seed, double *density,
+                      int *engine, int *kernel, int *depth,
+                      const char **pattern, int *memory, unsigned *rule, life_ltl_rule_t *ltl,
+                      life_lenia_rule_t *lenia, int *boundary);
+static int parse_engine(const char *name);
+static int parse_kernel(const char *name);
+static int parse_boundary(const char *name);
+
+static void board_init_byte(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static void board_init_packed(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static void board_init_list(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static void board_init_delta(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static void board_init_morton(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static void board_init_lenia(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern,
+                             const life_lenia_rule_t *rule, MPI_Comm comm);
+static void board_init_map(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static void run_hashlife(int rows, int cols, int epochs, unsigned int seed, double density, char *pattern, int memory);
+static void run_dhashlife(int rows, int cols, int epochs, unsigned int seed, double density, char *pattern, int memory);
+static void run_ensemble(int rows, int cols, int epochs, unsigned int seed, double density, char *pattern, MPI_Comm comm);
+static int board_grow(board_t *board, int shrink, MPI_Comm comm);
+static void board_exchange(board_t *board, MPI_Comm comm);
+static void board_step(board_t *board, int gens, life_stats_t *stats);
+static void board_swap(board_t *board);
+static void board_free(board_t *board);
 
 /* ********************************************************************************************* */
 
@@ -43,7 +162,19 @@ static int parse_args(int argc, char *argv[], int *rows, int *cols, int *epochs,
  *   -m <cols>        Number of columns in the board (positive integer)
  *   -e <epochs>      Number of simulation epochs (positive integer)
  *   -s <seed>        Optional random seed (positive integer; default: time-based)
+ *   -d <density>     Optional fraction of alive cells of the random board, in (0, 1] (default: LIFE_DENSITY)
+ *   -x <engine>      Optional engine: byte (default), packed, lut2, tiled, active, memo, hashlife, dhashlife, sparse, delta
+ *                    inplace, morton, ltl, lenia, ensemble, grow or map
+ *   -k <kernel>      Optional byte kernel: auto (default), scalar, sse2, avx2, colsum or lut
+ *   -t <depth>       Optional generations per tile of the tiled engine (default: DEFAULT_DEPTH)
+ *   -f <file>        Optional pattern file (plaintext or RLE) instead of a random board
+ *   -M <MiB>         Optional memory cap of the (per-rank) hashlife node table (default: DEFAULT_MEMORY)
+ *   -r <rule>        Optional Life-like rule in B/S notation, e.g. B36/S23 (default: B3/S23),
+ *                    or Larger-than-Life rule in Golly notation for the ltl engine, e.g. R5,C0,M1,S34..58,B34..45,NM,
+ *                    or Lenia rule for the lenia engine, e.g. R13,T10,M0.15,S0.015 (default of lenia: Orbium)
+ *   -b <boundary>    Optional boundary conditions: cylinder (default), torus, dead or reflect
  *
+ * With -f the board size comes from the file, so -n and -m are not required.
  * If any required argument is missing or invalid, prints usage and returns non-zero.
  *
  * @param argc        Argument count from main().
@@ -52,13 +183,38 @@ static int parse_args(int argc, char *argv[], int *rows, int *cols, int *epochs,
  * @param cols        OUT: pointer to store parsed number of columns.
  * @param epochs      OUT: pointer to store parsed number of epochs.
  * @param user_seed   OUT: pointer to store parsed seed (0 if none provided).
+ * @param density     OUT: pointer to store the density of the random board (LIFE_DENSITY if none provided).
+ * @param engine      OUT: pointer to store the selected engine (ENGINE_BYTE if none provided).
+ * @param kernel      OUT: pointer to store the selected kernel (LIFE_KERNEL_AUTO if none provided).
+ * @param depth       OUT: pointer to store the tiled engine depth (DEFAULT_DEPTH if none provided).
+ * @param pattern     OUT: pointer to store the pattern file path (NULL if none provided).
+ * @param memory      OUT: pointer to store the hashlife memory cap in MiB (DEFAULT_MEMORY if none provided).
+ * @param rule        OUT: pointer to store the rule mask (LIFE_RULE_LIFE if none provided).
+ * @param ltl         OUT: pointer to store the rule of the ltl engine (the B/S rule as radius 1
+ *                    if no Larger-than-Life rule is provided; radius 0 for the other engines).
+ * @param lenia       OUT: pointer to store the rule of the lenia engine (LIFE_LENIA_ORBIUM if none provided).
+ * @param boundary    OUT: pointer to store the boundary conditions (LIFE_BOUNDARY_CYLINDER if none provided).
  * @return            0 on successful parse; non-zero on failure.
  */
 static int parse_args(int argc, char *argv[],
                       int *rows, int *cols,
-                      int *epochs, int *user_seed) {
+                      int *epochs, int *user_seed, double *density,
+                      int *engine, int *kernel, int *depth,
+                      const char **pattern, int *memory, unsigned *rule, life_ltl_rule_t *ltl,
+                      life_lenia_rule_t *lenia, int *boundary) {
     
     *rows = *cols = *epochs = *user_seed = 0;
+    *density = LIFE_DENSITY;
+    *engine  = ENGINE_BYTE;
+    *kernel  = LIFE_KERNEL_AUTO;
+    *depth   = DEFAULT_DEPTH;
+    *pattern = NULL;
+    *memory  = DEFAULT_MEMORY;
+    *rule    = LIFE_RULE_LIFE;
+    *boundary = LIFE_BOUNDARY_CYLINDER;
+    memset(ltl, 0, sizeof(*ltl));
+    int lenia_given = 0;
+    *lenia = (life_lenia_rule_t)LIFE_LENIA_ORBIUM;
 
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
@@ -69,17 +225,75 @@ static int parse_args(int argc, char *argv[],
             *epochs = atoi(argv[++i]);
         } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
             *user_seed = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            *density = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+            *engine = parse_engine(argv[++i]);
+        } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            *kernel = parse_kernel(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            *depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            *pattern = argv[++i];
+        } else if (strcmp(argv[i], "-M") == 0 && i + 1 < argc) {
+            *memory = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            *boundary = parse_boundary(argv[++i]);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            if (life_lenia_parse_rule(argv[++i], lenia) == 0) {
+                lenia_given = 1;
+            } else if (life_parse_rule(argv[i], rule) != 0 && life_ltl_parse_rule(argv[i], ltl) != 0) {
+                fprintf(stderr, "Error: invalid rule '%s' (expected B<digits>/S<digits> without B0, "
+                                "R<r>,C0,M<0|1>,S<a>..<b>,B<c>..<d>,NM or R<r>,T<t>,M<mu>,S<sigma>).\n", argv[i]);
+                print_usage(argv[0]);
+                return -1;
+            }
         } else {
             print_usage(argv[0]);
             return -1;
         }
     }
 
-    if (*rows <= 0 || *cols <= 0 || *epochs <= 0) {
+    if ((!*pattern && (*rows <= 0 || *cols <= 0)) || *epochs <= 0 || !(*density > 0.0 && *density <= 1.0) ||
+        *engine < 0 || *kernel < 0 || *depth <= 0 || *memory <= 0 || *boundary < 0) {
         print_usage(argv[0]);
         return -1;
     }
 
+    // Lenia rules need the lenia engine
+    if (lenia_given && *engine != ENGINE_LENIA) {
+        fprintf(stderr, "Error: Lenia rules run on the lenia engine only (-x lenia).\n");
+        return -1;
+    }
+
+    // Larger-than-Life rules need the ltl engine, which also runs B/S rules made of two ranges
+    if (ltl->radius > 0 && *engine != ENGINE_LTL) {
+        fprintf(stderr, "Error: Larger-than-Life rules run on the ltl engine only (-x ltl).\n");
+        return -1;
+    }
+    if (*engine == ENGINE_LTL && ltl->radius == 0 && life_ltl_from_rule(*rule, ltl) != 0) {
+        fprintf(stderr, "Error: the ltl engine needs birth and survival counts in a single range each.\n");
+        return -1;
+    }
+
+    // The plane of hashlife, dhashlife and grow has no edges; the deep halo of lut2 and tiled
+    // computes the rows beyond an edge too, so they only wrap around
+    if (*boundary != LIFE_BOUNDARY_CYLINDER &&
+        (*engine == ENGINE_HASH || *engine == ENGINE_DHASH || *engine == ENGINE_GROW ||
+         *engine == ENGINE_LUT2 || *engine == ENGINE_TILED)) {
+        fprintf(stderr, "Error: the %s engine only runs with the default boundary (cylinder).\n",
+                ENGINE_NAMES[*engine]);
+        return -1;
+    }
+
+    // Wrapped and mirrored columns are filled into the ghost columns of the byte slabs
+    if ((*boundary == LIFE_BOUNDARY_TORUS || *boundary == LIFE_BOUNDARY_REFLECT) &&
+        *engine != ENGINE_BYTE && *engine != ENGINE_MEMO && *engine != ENGINE_INPLACE && *engine != ENGINE_MAP) {
+        fprintf(stderr, "Error: the %s boundary runs on the byte, memo, inplace and map engines only.\n",
+                life_boundary_name(*boundary));
+        return -1;
+    }
+
     return 0;
 }
 
@@ -91,17 +305,818 @@ static int parse_args(int argc, char *argv[],
  *   - -m <cols>       Number of columns in the board (positive integer)
  *   - -e <epochs>     Number of simulation epochs (positive integer)
  *   - -s <seed>       Optional random seed (positive integer; default: time-based)
+ *   - -d <density>    Optional fraction of alive cells of the random board (in (0, 1]; default: 0.5)
+ *   - -x <engine>     Optional engine (byte, packed, lut2, tiled, active, memo, hashlife, dhashlife, sparse, delta, inplace, morton, ltl, lenia, ensemble, grow or map; default: byte)
+ *   - -k <kernel>     Optional byte kernel (auto, scalar, sse2, avx2, colsum or lut; default: auto)
+ *   - -t <depth>      Optional generations per tile of the tiled engine (default: 4)
+ *   - -f <file>       Optional pattern file, plaintext or RLE (replaces -n, -m and the random board)
+ *   - -M <MiB>        Optional memory cap of the (per-rank) hashlife node table (default: 1024)
+ *   - -r <rule>       Optional Life-like rule in B/S notation (default: B3/S23), or Larger-than-Life rule for ltl,
+ *                     or Lenia rule for lenia
+ *   - -b <boundary>   Optional boundary conditions (cylinder, torus, dead or reflect; default: cylinder)
  *
  * @param prog_name  Name of the executable (used to format the usage string)
  */
 static void print_usage(const char *prog_name) {
     fprintf(stderr,
-        "Usage: %s -n <rows> -m <cols> -e <epochs> [-s <seed>]\n"
+        "Usage: %s -n <rows> -m <cols> -e <epochs> [-s <seed>] [-d <density>] [-x <engine>] [-k <kernel>]\n"
+        "                  [-t <depth>] [-M <MiB>] [-r <rule>] [-b <boundary>]\n"
+        "       %s -f <file> -e <epochs> [options]\n"
         "  -n <rows>        Number of rows in the board (positive integer)\n"
         "  -m <cols>        Number of columns in the board (positive integer)\n"
-        "  -i <epochs>      Number of simulation epochs (positive integer)\n"
-        "  -s <seed>        Optional random seed (positive integer; default: time-based)\n",
-        prog_name);
+        "  -e <epochs>      Number of simulation epochs (positive integer)\n"
+        "  -s <seed>        Optional random seed (positive integer; default: time-based)\n"
+        "  -d <density>     Optional fraction of alive cells of the random board, in (0, 1] (default: 0.5)\n"
+        "  -x <engine>      Optional engine: byte (default), packed, lut2 (two generations per step)\n"
+        "                   tiled (T generations per cache-sized tile), active (skip settled tiles)\n"
+        "                   memo (cached 8x8 tiles), hashlife (single rank, unbounded plane)\n"
+        "                   dhashlife (hashlife with the quadtree spread over all ranks)\n"
+        "                   sparse (alive-cell lists, for low-density boards)\n"
+        "                   delta (neighbor counts updated from flips, for slowly evolving boards)\n"
+        "                   inplace (byte board rewritten in place, about half the slab memory)\n"
+        "                   morton (square tiles stored in Z-order, for very wide boards)\n"
+        "                   ltl (Larger-than-Life rules of radius R, O(1) neighbor sums)\n"
+        "                   lenia (continuous Lenia states, kernel convolution by FFT)\n"
+        "                   ensemble (64 boards of seeds S..S+63 in the bits of every word)\n"
+        "                   grow (unbounded plane, the window follows the pattern across ranks)\n"
+        "                   or map (out-of-core: slab in memory-mapped files under $TMPDIR, in bands)\n"
+        "  -k <kernel>      Optional byte kernel: auto (default, CPUID), scalar, sse2, avx2, colsum, lut\n"
+        "  -t <depth>       Optional generations per tile T of the tiled engine (default: 4)\n"
+        "  -f <file>        Optional pattern file (plaintext .cells or RLE) instead of a random board\n"
+        "  -M <MiB>         Optional memory cap of the hashlife node table, per rank (default: 1024)\n"
+        "  -r <rule>        Optional rule in B/S notation, e.g. B36/S23 (default: B3/S23, Conway's Life)\n"
+        "                   or Larger-than-Life rule for ltl, e.g. R5,C0,M1,S34..58,B34..45,NM\n"
+        "                   or Lenia rule for lenia, e.g. R13,T10,M0.15,S0.015 (default: Orbium)\n"
+        "  -b <boundary>    Optional boundary conditions: cylinder (default: rows wrap, sides dead)\n"
+        "                   torus (rows and columns wrap), dead (bounded plane) or reflect (mirrored edges)\n",
+        prog_name, prog_name);
+}
+
+/**
+ * @brief Map an engine name given on the command line to its ENGINE_* id.
+ *
+ * @param name Engine name (e.g., "byte", "packed", "lut2", "tiled", "active", "memo", "hashlife", "dhashlife", "sparse", "delta", "inplace", "morton", "ltl", "lenia", "ensemble", "grow" or "map").
+ * @return The matching ENGINE_* value, or -1 if the name is unknown.
+ */
+static int parse_engine(const char *name) {
+    for (int e = 0; e < ENGINE_COUNT; e++) {
+        if (strcmp(name, ENGINE_NAMES[e]) == 0) return e;
+    }
+    return -1;
+}
+
+/**
+ * @brief Map a kernel name given on the command line to its LIFE_KERNEL_* id.
+ *
+ * @param name Kernel name (e.g., "auto", "scalar", "sse2" or "avx2").
+ * @return The matching LIFE_KERNEL_* value, or -1 if the name is unknown.
+ */
+static int parse_kernel(const char *name) {
+    for (int k = 0; k < LIFE_KERNEL_COUNT; k++) {
+        if (strcmp(name, life_kernel_name(k)) == 0) return k;
+    }
+    return -1;
+}
+
+/**
+ * @brief Map a boundary name given on the command line to its LIFE_BOUNDARY_* id.
+ *
+ * @param name Boundary name ("cylinder", "torus", "dead" or "reflect").
+ * @return The matching LIFE_BOUNDARY_* value, or -1 if the name is unknown.
+ */
+static int parse_boundary(const char *name) {
+    for (int b = 0; b < LIFE_BOUNDARY_COUNT; b++) {
+        if (strcmp(name, life_boundary_name(b)) == 0) return b;
+    }
+    return -1;
+}
+
+/* ********************************************************************************************* */
+
+/**
+ * @brief Create, scatter and lay out the byte board (one char per cell).
+ *
+ * A random board is drawn by every rank, each its own rows, with
+ * mpi_random_board(), so the full board never exists and is the same for
+ * any number of ranks. A loaded pattern is scattered from MASTER with
+ * mpi_scatter_board(). Either way the rows land straight in the padded
+ * current buffer, which has board->halo ghost rows on each side.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ */
+static void board_init_byte(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    // 5. Only MASTER knows whether a pattern was loaded
+    int loaded = rank == 0 && pattern != NULL;
+    MPI_Bcast(&loaded, 1, MPI_INT, 0, comm);
+
+    // 6. Fill the slab of each rank: drawn in place, or scattered row-wise from the pattern;
+    //    current will point to a padded buffer of size (local_rows + 2*halo) × pitch,
+    //    each row with a ghost column on both sides and padded to a cache line;
+    //    the real rows land straight in current[halo .. halo+local_rows-1]
+    int pitch = life_pitch(cols);
+    int halo  = board->halo;
+    char *current = NULL;
+    int local_rows = 0;
+    if (loaded) {
+        mpi_scatter_board(pattern, rows, cols, pitch, halo, &current, &local_rows, comm);
+        life_destroy(pattern);
+    } else {
+        mpi_random_board(rows, cols, halo, seed, density, &current, &local_rows, comm);
+    }
+
+    // 7. Ghost rows of a deeper halo come from the direct neighbors only
+    if (local_rows < halo) {
+        fprintf(stderr, "Error: rank %d owns %d rows, fewer than the %d ghost rows required.\n",
+                rank, local_rows, halo);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    // 8. Allocate the next padded buffer, same size as current (zeroed, so ghost rows,
+    //    ghost columns and padding start dead); the in-place engine only needs its
+    //    small row ring, allocated here once for the whole run
+    char *next = NULL;
+    if (board->engine == ENGINE_INPLACE) {
+        board->spare = life_alloc(LIFE_INPLACE_ROWS, cols);
+        if (!board->spare) {
+            fprintf(stderr, "Error: failed to allocate the in-place row ring on rank %d.\n", rank);
+            MPI_Abort(comm, EXIT_FAILURE);
+        }
+    } else {
+        next = life_alloc(local_rows + 2 * (halo - 1), cols);
+        if (!next) {
+            fprintf(stderr, "Error: failed to allocate local buffers on rank %d.\n", rank);
+            MPI_Abort(comm, EXIT_FAILURE);
+        }
+    }
+
+    board->local_rows = local_rows;
+    board->stride     = pitch;
+    board->current    = current;
+    board->next       = next;
+}
+
+/**
+ * @brief Create, scatter and lay out the packed board (one bit per cell).
+ *
+ * Every rank draws its rows of a random board with mpi_random_board_packed()
+ * (same seed, same cells as the byte board), or MASTER packs the loaded
+ * pattern and scatters its rows; either way the rows land straight in zeroed
+ * padded buffers with ghost words, which then serve as the current generation.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ */
+static void board_init_packed(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    int words = life_packed_words(cols);
+    board->stride = words + 2;
+
+    int loaded = rank == 0 && pattern != NULL;
+    MPI_Bcast(&loaded, 1, MPI_INT, 0, comm);
+
+    uint64_t *local_packed = NULL;
+    if (loaded) {
+        uint64_t *full_packed = NULL;
+        if (rank == 0) {
+            full_packed = life_pack(pattern, rows, cols);
+            life_destroy(pattern);
+            if (!full_packed) {
+                fprintf(stderr, "Error: failed to allocate full board on MASTER.\n");
+                MPI_Abort(comm, EXIT_FAILURE);
+            }
+        }
+        mpi_scatter_board_packed(full_packed, rows, words, &local_packed, &board->local_rows, comm);
+        life_destroy_packed(full_packed);
+    } else {
+        mpi_random_board_packed(rows, cols, seed, density, &local_packed, &board->local_rows, comm);
+    }
+
+    // Ghost rows come from the direct neighbors only
+    if (board->local_rows < board->halo) {
+        fprintf(stderr, "Error: rank %d owns %d rows, fewer than the %d ghost rows required.\n",
+                rank, board->local_rows, board->halo);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    // Scattered buffer becomes current; next only needs zeroed ghost words
+    board->current = local_packed;
+    board->next    = calloc((size_t)(board->local_rows + 2) * board->stride, sizeof(uint64_t));
+    if (!board->next) {
+        fprintf(stderr, "Error: failed to allocate local buffers on rank %d.\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+}
+
+/**
+ * @brief Create, scatter and convert the sparse board (alive columns per row).
+ *
+ * The rows are drawn (or scattered) exactly as for the byte board; every
+ * rank then keeps only the columns of its alive cells and releases the
+ * padded rows.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ */
+static void board_init_list(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    board_init_byte(board, rows, cols, seed, density, pattern, comm);
+    life_list_t *current = life_list_create(board->current, board->local_rows, cols, board->stride);
+    life_list_t *next    = life_list_create(NULL, board->local_rows, cols, board->stride);
+    if (!current || !next) {
+        fprintf(stderr, "Error: failed to allocate the sparse slab on rank %d.\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    free(board->current);
+    free(board->next);
+    board->current = current;
+    board->next    = next;
+}
+
+/**
+ * @brief Create, scatter and convert the event-driven board (cells plus neighbor counts).
+ *
+ * The rows are drawn (or scattered) exactly as for the byte board; every
+ * rank then builds its delta slab and releases the padded rows. There is no
+ * `next` slab: life_step_delta() updates the cells in place.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ */
+static void board_init_delta(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    board_init_byte(board, rows, cols, seed, density, pattern, comm);
+    life_delta_t *delta = life_delta_create(board->current, board->local_rows, cols, board->stride);
+    if (!delta) {
+        fprintf(stderr, "Error: failed to allocate the delta slab on rank %d.\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    free(board->current);
+    free(board->next);
+    board->current = delta;
+    board->next    = NULL;
+}
+
+/**
+ * @brief Create, scatter and convert the Morton board (square tiles in Z-order).
+ *
+ * The rows are drawn (or scattered) exactly as for the byte board; every
+ * rank then copies its rows into the tile layout and releases the padded
+ * rows.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ */
+static void board_init_morton(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    board_init_byte(board, rows, cols, seed, density, pattern, comm);
+    life_morton_t *current = life_morton_create(board->current, board->local_rows, cols, board->stride);
+    life_morton_t *next    = life_morton_create(NULL, board->local_rows, cols, board->stride);
+    if (!current || !next) {
+        fprintf(stderr, "Error: failed to allocate the Morton slab on rank %d.\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    free(board->current);
+    free(board->next);
+    board->current = current;
+    board->next    = next;
+}
+
+/**
+ * @brief Create, scatter and convert the Lenia board (float states, FFT workspace).
+ *
+ * The rows are drawn (or scattered) exactly as for the byte board, with R
+ * ghost rows so that every rank is checked to own at least R rows; every
+ * rank then builds its float slab (alive cells start at state 1) and
+ * releases the padded rows. There is no `next` slab: life_step_lenia() swaps
+ * internally.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ * @param rule    Lenia rule (radius = board->halo).
+ */
+static void board_init_lenia(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern,
+                             const life_lenia_rule_t *rule, MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    board_init_byte(board, rows, cols, seed, density, pattern, comm);
+    const char *buf = (const char *)board->current + (size_t)(board->halo - 1) * board->stride;
+    life_lenia_t *lenia = life_lenia_create(buf, board->local_rows, cols, board->stride, rule);
+    if (!lenia) {
+        fprintf(stderr, "Error: failed to allocate the Lenia slab on rank %d.\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    free(board->current);
+    free(board->next);
+    board->current = lenia;
+    board->next    = NULL;
+}
+
+/**
+ * @brief Stream the board into memory-mapped slabs (out-of-core byte board).
+ *
+ * Unlike board_init_byte(), no rank ever allocates a slab: every rank draws
+ * its rows of a random board straight into its mapped file, under $TMPDIR
+ * (or /tmp), and a pattern is sent by MASTER one band of rows at a time
+ * (mpi_scatter_board_map()). There is no `next` slab: life_step_map() swaps
+ * the two mapped generations itself.
+ *
+ * @param pattern Board loaded by MASTER with life_load(), or NULL; freed here.
+ */
+static void board_init_map(board_t *board, int rows, int cols, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Ghost rows come from the direct neighbors only: check the row split before mapping any slab
+    int local_rows = rows / size + (rank < rows % size ? 1 : 0);
+    if (local_rows < board->halo) {
+        fprintf(stderr, "Error: rank %d owns %d rows, fewer than the %d ghost rows required.\n",
+                rank, local_rows, board->halo);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    life_map_t *map = NULL;
+    mpi_scatter_board_map(pattern, rows, cols, seed, density, NULL, &map, comm);
+    life_destroy(pattern);
+
+    board->local_rows = map->rows;
+    board->stride     = map->pitch;
+    board->current    = map;
+    board->next       = NULL;
+}
+
+/**
+ * @brief Refit the window of the grow engine around the alive cells.
+ *
+ * The kernels take the cells beyond the window as dead, which is exact as
+ * long as no alive cell lies on its border: births then stay inside. Every
+ * rank checks its part of the border in O(rows + cols); once an alive cell
+ * reaches it (or, with `shrink`, once the window is more than twice the size
+ * it needs in a dimension), the window becomes the live box of all ranks
+ * plus a margin of GROW_MARGIN and 1/8 of the box on every side, and the
+ * slabs move there with mpi_regrid_board(). The rows of the new window are
+ * split evenly again, so memory and work follow the pattern.
+ *
+ * @param shrink Non-zero to also release a window much larger than the pattern.
+ * @return 1 if the window moved, 0 otherwise.
+ */
+static int board_grow(board_t *board, int shrink, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // The top and bottom rows of the window belong to the first and last ranks
+    long edge = life_edge_alive(board->current, board->local_rows, board->cols, board->stride,
+                                rank == 0, rank == size - 1);
+    int touched = mpi_allreduce_count(edge, comm) > 0;
+    if (!touched && !shrink) return 0;
+
+    long box[4];
+    mpi_window_bounds(board->current, board->local_rows, &board->window, box, comm);
+    if (box[0] > box[2]) return 0;      // every cell is dead, the run is about to stop
+
+    long height = box[2] - box[0] + 1, width = box[3] - box[1] + 1;
+    long margin_rows = GROW_MARGIN + height / 8, margin_cols = GROW_MARGIN + width / 8;
+    life_window_t to = { box[0] - margin_rows, box[1] - margin_cols,
+                         (int)(height + 2 * margin_rows), (int)(width + 2 * margin_cols) };
+    if (to.rows < size) to.rows = size;     // every rank owns at least one row
+    if (!touched && board->window.rows <= 2 * to.rows && board->window.cols <= 2 * to.cols) return 0;
+
+    char *current = board->current;
+    mpi_regrid_board(&current, &board->local_rows, &board->window, &to, comm);
+    free(board->next);
+    board->current = current;
+    board->next    = life_alloc(board->local_rows, to.cols);
+    if (!board->next) {
+        fprintf(stderr, "Error: failed to allocate local buffers on rank %d.\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    board->window = to;
+    board->cols   = to.cols;
+    board->stride = life_pitch(to.cols);
+    return 1;
+}
+
+/**
+ * @brief Fill the ghost rows of the current generation from neighbor ranks
+ *        (and the ghost cells the torus and reflect boundaries derive from the slab).
+ */
+static void board_exchange(board_t *board, MPI_Comm comm) {
+    if (board->engine == ENGINE_PACKED) {
+        mpi_exchange_ghosts_packed(board->current, board->local_rows, board->stride, comm);
+    } else if (board->engine == ENGINE_SPARSE) {
+        mpi_exchange_ghosts_list(board->current, comm);
+    } else if (board->engine == ENGINE_DELTA) {
+        mpi_exchange_ghosts_delta(board->current, comm);
+    } else if (board->engine == ENGINE_MORTON) {
+        mpi_exchange_ghosts_morton(board->current, comm);
+    } else if (board->engine == ENGINE_LENIA) {
+        mpi_exchange_ghosts_lenia(board->current, comm);
+    } else if (board->halo > 1) {
+        mpi_exchange_halo(board->current, board->local_rows, board->cols, board->stride,
+                          board->halo, comm);
+    } else {
+        char *buf = board->engine == ENGINE_MAP ? ((life_map_t *)board->current)->current : board->current;
+        mpi_exchange_ghosts(buf, board->local_rows, board->cols, board->stride, comm);
+
+        // Torus and reflect: ghost cells copied from the slab itself (branch-free per mode)
+        if (board->boundary == LIFE_BOUNDARY_TORUS || board->boundary == LIFE_BOUNDARY_REFLECT) {
+            int rank, size;
+            MPI_Comm_rank(comm, &rank);
+            MPI_Comm_size(comm, &size);
+            life_fill_edges(buf, board->local_rows, board->cols, board->stride, board->boundary,
+                            rank == 0, rank == size - 1);
+        }
+    }
+}
+
+/**
+ * @brief Advance the local slab by `gens` generations into board->next (or in place).
+ *
+ * @param gens  Generations to advance, 1..board->gens (the last step of a run
+ *              may be shorter than board->gens).
+ * @param stats OUT: local population, births, deaths and change flag of the
+ *              last generation computed. A step of several generations also
+ *              leaves the local population of each one in board->gen_alive.
+ */
+static void board_step(board_t *board, int gens, life_stats_t *stats) {
+    if (board->engine == ENGINE_PACKED) {
+        life_step_packed(board->current, board->next, board->local_rows, board->cols, stats);
+        return;
+    }
+    if (board->engine == ENGINE_SPARSE) {
+        if (life_step_list(board->current, board->next, stats) != 0) {
+            fprintf(stderr, "Error: failed to grow the sparse slab.\n");
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+        return;
+    }
+    if (board->engine == ENGINE_DELTA) {
+        if (life_step_delta(board->current, stats) != 0) {
+            fprintf(stderr, "Error: failed to grow the delta flip lists.\n");
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+        return;
+    }
+    if (board->engine == ENGINE_MORTON) {
+        life_step_morton(board->current, board->next, stats);
+        return;
+    }
+    if (board->engine == ENGINE_LENIA) {
+        life_step_lenia(board->current, stats);
+        return;
+    }
+    if (board->engine == ENGINE_MAP) {
+        life_step_map(board->current, stats);
+        return;
+    }
+    if (board->engine == ENGINE_LTL) {
+        life_step_ltl(board->ltl, board->current, board->next, board->local_rows, board->stride, stats);
+        return;
+    }
+    if (board->engine == ENGINE_INPLACE) {
+        life_step_inplace(board->current, board->spare, board->local_rows, board->cols, board->stride, stats);
+        return;
+    }
+
+    // Byte engines: start where only `gens` of the halo rows above the slab are needed
+    size_t skip = (size_t)(board->halo - gens) * board->stride;
+    const char *current = (const char *)board->current + skip;
+    char *next          = (char *)board->next + skip;
+
+    if (board->engine == ENGINE_TILED) {
+        if (life_step_tiled(current, next, board->local_rows, board->cols, board->stride,
+                            gens, LIFE_TILE_ROWS, LIFE_TILE_COLS, stats, board->gen_alive) != 0) {
+            fprintf(stderr, "Error: failed to allocate scratch tiles.\n");
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    } else if (board->engine == ENGINE_LUT2 && gens == 2) {
+        life_step2_lut(current, next, board->local_rows, board->cols, board->stride, stats, board->gen_alive);
+    } else if (board->engine == ENGINE_ACTIVE) {
+        life_step_active(board->tiles, current, next, board->spare, board->stride, stats);
+    } else if (board->engine == ENGINE_MEMO) {
+        life_step_memo(board->memo, current, next, board->local_rows, board->cols, board->stride, stats);
+    } else {
+        life_step(current, next, board->local_rows, board->cols, board->stride, stats);
+    }
+}
+
+/**
+ * @brief Swap buffers: current ← next, next ← current (nothing to do for the in-place engines
+ *        and for lenia and map, which swap their generations themselves).
+ */
+static void board_swap(board_t *board) {
+    if (board->engine == ENGINE_DELTA || board->engine == ENGINE_INPLACE || board->engine == ENGINE_LENIA ||
+        board->engine == ENGINE_MAP) return;
+
+    void *tmp      = board->current;
+    board->current = board->next;
+    board->next    = tmp;
+}
+
+/**
+ * @brief Release the buffers and engine state of the local slab (and the kernel scratch).
+ */
+static void board_free(board_t *board) {
+    life_kernel_release();
+
+    if (board->engine == ENGINE_SPARSE) {
+        life_list_destroy(board->current);
+        life_list_destroy(board->next);
+        return;
+    }
+    if (board->engine == ENGINE_DELTA) {
+        life_delta_destroy(board->current);
+        return;
+    }
+    if (board->engine == ENGINE_MORTON) {
+        life_morton_destroy(board->current);
+        life_morton_destroy(board->next);
+        return;
+    }
+    if (board->engine == ENGINE_LENIA) {
+        life_lenia_destroy(board->current);
+        return;
+    }
+    if (board->engine == ENGINE_MAP) {
+        life_map_destroy(board->current);
+        return;
+    }
+    free(board->current);
+    free(board->next);
+    free(board->spare);
+    life_tiles_destroy(board->tiles);
+    life_memo_destroy(board->memo);
+    life_ltl_destroy(board->ltl);
+    free(board->gen_alive);
+}
+
+/**
+ * @brief Run the whole simulation with the HashLife engine (single rank).
+ *
+ * The board is loaded into a quadtree universe (unbounded plane, see
+ * lifehash.h) and advanced in jumps of 2^k generations, largest first, so
+ * `epochs` generations take about log2(epochs) jumps. The population is
+ * printed after every jump; the run stops early once every cell is dead.
+ *
+ * @param pattern Board loaded with life_load(), or NULL for a random board; freed here.
+ * @param memory  Memory cap of the node table in MiB.
+ */
+static void run_hashlife(int rows, int cols, int epochs, unsigned int seed, double density, char *pattern, int memory) {
+    // 5. Build the board (random or loaded) and turn it into the quadtree
+    char *board = pattern ? pattern : life_create(rows, cols, seed, density);
+    life_hash_t *hash = life_hash_create((size_t)memory << 20);
+    if (!board || !hash || life_hash_load(hash, board, rows, cols) != 0) {
+        fprintf(stderr, "Error: failed to build the HashLife universe.\n");
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+    life_destroy(board);
+
+    double start_time = get_time();
+
+    // 9. Jump 2^k generations at a time, largest power of two that still fits
+    int gen = 0;
+    while (gen < epochs) {
+        int log2_gens = 0;
+        while (log2_gens < 30 && (1L << (log2_gens + 1)) <= (long)(epochs - gen)) log2_gens++;
+
+        if (life_hash_advance(hash, log2_gens) != 0) {
+            fprintf(stderr, "Error: HashLife node table too small, raise -M.\n");
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+        gen += 1 << log2_gens;
+
+        long alive = (long)life_hash_population(hash);
+        if (alive == 0) {
+            printf("All cells are dead at generation %d, exiting early.\n", gen);
+            break;
+        }
+        printf("[Gen %4d] Alive cells = %ld  Elapsed = %.4f s\n",
+               gen, alive, get_time() - start_time);
+    }
+
+    // 10. Final summary
+    double total_time = get_time() - start_time;
+    printf("Simulation complete on a %dx%d board across 1 ranks.\n", rows, cols);
+    printf("Total time: %.4f s  Avg time/gen: %.6f s\n", total_time, total_time / epochs);
+    printf("Node table: %zu live nodes, %ld collections\n", hash->live, hash->collections);
+
+    life_hash_destroy(hash);
+}
+
+/**
+ * @brief Run the whole simulation with the distributed HashLife engine (all ranks).
+ *
+ * Same jumps as run_hashlife(), but the quadtree nodes are hash-partitioned
+ * across the ranks (see lifedhash.h), so the node tables of all ranks add
+ * up and `memory` is the cap of each of them. MASTER builds the board and
+ * sends its leaves to their owners; every rank takes part in every jump.
+ *
+ * @param pattern On MASTER: board loaded with life_load(), or NULL for a random board; freed here.
+ * @param memory  Memory cap of each rank's node table in MiB.
+ */
+static void run_dhashlife(int rows, int cols, int epochs, unsigned int seed, double density, char *pattern, int memory) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // 5. Build the board (random or loaded) on MASTER and spread the quadtree
+    char *board = NULL;
+    if (rank == 0) {
+        board = pattern ? pattern : life_create(rows, cols, seed, density);
+        if (!board) {
+            fprintf(stderr, "Error: failed to create the board.\n");
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    }
+    life_dhash_t *hash = life_dhash_create((size_t)memory << 20, MPI_COMM_WORLD);
+    if (!hash) {
+        fprintf(stderr, "Error: failed to allocate the HashLife node table on rank %d.\n", rank);
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+    if (life_dhash_load(hash, board, rows, cols) != 0) {
+        if (rank == 0) fprintf(stderr, "Error: failed to build the HashLife universe.\n");
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+    life_destroy(board);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start_time = get_time();
+
+    // 9. Jump 2^k generations at a time, largest power of two that still fits
+    int gen = 0;
+    while (gen < epochs) {
+        int log2_gens = 0;
+        while (log2_gens < 30 && (1L << (log2_gens + 1)) <= (long)(epochs - gen)) log2_gens++;
+
+        if (life_dhash_advance(hash, log2_gens) != 0) {
+            if (rank == 0) fprintf(stderr, "Error: HashLife node tables too small, raise -M.\n");
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+        gen += 1 << log2_gens;
+
+        long alive = (long)life_dhash_population(hash);
+        if (alive == 0) {
+            if (rank == 0) printf("All cells are dead at generation %d, exiting early.\n", gen);
+            break;
+        }
+        if (rank == 0) {
+            printf("[Gen %4d] Alive cells = %ld  Elapsed = %.4f s\n",
+                   gen, alive, get_time() - start_time);
+        }
+    }
+
+    // 10. Final summary (node tables summed over the ranks)
+    double total_time = get_time() - start_time;
+    long live = mpi_reduce_count((long)hash->live, MPI_COMM_WORLD);
+    if (rank == 0) {
+        printf("Simulation complete on a %dx%d board across %d ranks.\n", rows, cols, size);
+        printf("Total time: %.4f s  Avg time/gen: %.6f s\n", total_time, total_time / epochs);
+        printf("Node table: %ld live nodes, %ld collections, %ld supersteps\n",
+               live, hash->collections, hash->supersteps);
+    }
+
+    life_dhash_destroy(hash);
+}
+
+/**
+ * @brief Run the whole simulation with the ensemble engine (all ranks, 64 boards).
+ *
+ * Every rank draws its rows of LIFE_LANES boards, lane k being the board of
+ * a run seeded with seed + k (mpi_random_board_ensemble()), or MASTER copies
+ * the loaded pattern into every lane and scatters its rows like the packed
+ * board with one word per cell. Each generation advances every lane still
+ * active; the three early-exit conditions of the main loop are checked per
+ * lane on the reduced per-lane statistics, and a lane that meets one is
+ * frozen with its exit generation and reason. The run stops when every lane
+ * has exited or after `epochs` generations, and MASTER prints the outcome of
+ * every lane.
+ *
+ * @param pattern On MASTER: board loaded with life_load(), or NULL for random boards; freed here.
+ * @param comm    Line of ranks from mpi_create_line().
+ */
+static void run_ensemble(int rows, int cols, int epochs, unsigned int seed, double density, char *pattern, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // 5. Only MASTER knows whether a pattern was loaded
+    int spread = rank == 0 && pattern != NULL;
+    MPI_Bcast(&spread, 1, MPI_INT, 0, comm);
+
+    // Ghost rows come from the direct neighbors only: every rank needs a real row
+    if (rows / size + (rank < rows % size ? 1 : 0) < 1) {
+        fprintf(stderr, "Error: rank %d owns 0 rows, fewer than the 1 ghost rows required.\n", rank);
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+
+    // 6-8. Rows of cols words in padded buffers (ghost words and rows dead): every rank
+    //      draws the 64 boards interleaved bit by bit, or MASTER spreads and scatters the pattern
+    int stride = cols + 2;
+    uint64_t *current = NULL;
+    int local_rows = 0;
+    if (spread) {
+        uint64_t *full_board = NULL;
+        if (rank == 0) {
+            full_board = life_spread(pattern, rows, cols);
+            life_destroy(pattern);
+            if (!full_board) {
+                fprintf(stderr, "Error: failed to allocate the ensemble on MASTER.\n");
+                MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+            }
+        }
+        mpi_scatter_board_packed(full_board, rows, cols, &current, &local_rows, comm);
+        life_destroy_packed(full_board);
+    } else {
+        mpi_random_board_ensemble(rows, cols, seed, density, &current, &local_rows, comm);
+    }
+    uint64_t *next = calloc((size_t)(local_rows + 2) * stride, sizeof(uint64_t));
+    if (!next) {
+        fprintf(stderr, "Error: failed to allocate local buffers on rank %d.\n", rank);
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+
+    // Per-lane early-exit state: reason 0 = still running, 1 = steady, 2 = dead, 3 = stable count
+    uint64_t active = ~UINT64_C(0);
+    int exit_gen[LIFE_LANES], reason[LIFE_LANES] = { 0 }, stable_count[LIFE_LANES] = { 0 };
+    long prev_alive[LIFE_LANES];
+    life_lanes_t global = { { 0 }, 0 };
+    for (int k = 0; k < LIFE_LANES; k++) prev_alive[k] = -1;
+
+    double start_time = get_time();
+    long lane_gens = 0;     // board-generations computed (active lanes only)
+
+    // 9. Advance all active lanes together until every lane exited or epochs ran out
+    int gen = 0;
+    while (gen < epochs && active) {
+        mpi_exchange_ghosts_packed(current, local_rows, stride, comm);
+
+        life_lanes_t local;
+        life_step_ensemble(current, next, local_rows, cols, active, &local);
+        mpi_reduce_lanes(&local, &global, comm);
+        lane_gens += __builtin_popcountll(active);
+        gen++;
+
+        uint64_t *tmp = current;
+        current = next;
+        next    = tmp;
+
+        // Same checks, in the same order, as the main loop, one lane at a time
+        long alive = 0;
+        for (int k = 0; k < LIFE_LANES; k++) {
+            alive += global.alive[k];
+            if (!((active >> k) & 1)) continue;
+
+            if (!((global.changed >> k) & 1)) {
+                reason[k] = 1;
+            } else if (global.alive[k] == 0) {
+                reason[k] = 2;
+            } else {
+                stable_count[k] = (prev_alive[k] == global.alive[k]) ? stable_count[k] + 1 : 0;
+                prev_alive[k]   = global.alive[k];
+                if (stable_count[k] >= STABLE_THRESHOLD) reason[k] = 3;
+            }
+            if (reason[k]) {
+                exit_gen[k] = gen;
+                active &= ~(UINT64_C(1) << k);
+            }
+        }
+
+        if (rank == 0) {
+            printf("[Gen %4d] Alive cells = %ld  Active lanes = %d  Elapsed = %.4f s\n",
+                   gen, alive, __builtin_popcountll(active), get_time() - start_time);
+        }
+    }
+
+    // 10. Final summary: outcome of every lane, then the ensemble throughput
+    double total_time = get_time() - start_time;
+    if (rank == 0) {
+        for (int k = 0; k < LIFE_LANES; k++) {
+            const char *what = reason[k] == 1 ? "steady state" : reason[k] == 2 ? "all cells dead" :
+                               reason[k] == 3 ? "alive count stable" : "still running";
+            printf("Lane %2d (seed %u): %s at generation %d, %ld alive cells\n",
+                   k, spread ? seed : seed + (unsigned int)k, what, reason[k] ? exit_gen[k] : gen,
+                   global.alive[k]);
+        }
+        printf("Simulation complete on 64 boards of %dx%d across %d ranks.\n", rows, cols, size);
+        printf("Total time: %.4f s  Avg time/gen: %.6f s  Board-generations/s: %.1f\n",
+               total_time, total_time / epochs, total_time > 0 ? lane_gens / total_time : 0.0);
+    }
+
+    free(current);
+    free(next);
 }
 
 /* ********************************************************************************************* */
@@ -117,13 +1132,34 @@ int main(int argc, char *argv[]) {
     // 2. Initialize command-line arguments
     int rows = 0, cols = 0, epochs = 0;
     int user_seed = 0;
+    double density = LIFE_DENSITY;
+    int engine = ENGINE_BYTE;
+    int kernel = LIFE_KERNEL_AUTO;
+    int depth = DEFAULT_DEPTH;
+    int memory = DEFAULT_MEMORY;
+    unsigned rule = LIFE_RULE_LIFE;
+    life_ltl_rule_t ltl_rule;
+    life_lenia_rule_t lenia_rule;
+    int boundary = LIFE_BOUNDARY_CYLINDER;
+    const char *pattern_path = NULL;
+    char *pattern = NULL;
 
     // 3. Parse command-line arguments
     //    and share them to the others processes
     if (rank == 0) {
-        if (parse_args(argc, argv, &rows, &cols, &epochs, &user_seed) != 0) {
+        if (parse_args(argc, argv, &rows, &cols, &epochs, &user_seed, &density, &engine, &kernel, &depth,
+                       &pattern_path, &memory, &rule, &ltl_rule, &lenia_rule, &boundary) != 0) {
             MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
         }
+
+        // A pattern file fixes the board size (MASTER keeps the cells until the scatter)
+        if (pattern_path) {
+            pattern = life_load(pattern_path, &rows, &cols);
+            if (!pattern) {
+                fprintf(stderr, "Error: cannot load pattern file '%s'.\n", pattern_path);
+                MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+            }
+        }
     }
 
     // Broadcast parsed values to everyone
@@ -131,79 +1167,189 @@ int main(int argc, char *argv[]) {
     MPI_Bcast(&cols,      1, MPI_INT, 0, MPI_COMM_WORLD);
     MPI_Bcast(&epochs,    1, MPI_INT, 0, MPI_COMM_WORLD);
     MPI_Bcast(&user_seed, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&density,   1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&engine,    1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&kernel,    1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&depth,     1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&memory,    1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&rule,      1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&ltl_rule,  (int)sizeof(ltl_rule), MPI_BYTE, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&lenia_rule, (int)sizeof(lenia_rule), MPI_BYTE, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&boundary,  1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    // Each rank resolves the kernel variant of the rule against its own CPU (CPUID)
+    life_set_rule(rule);
+    kernel = life_select_kernel(kernel);
+    if (kernel < 0) {
+        fprintf(stderr, "Error: requested kernel is not supported on rank %d.\n", rank);
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
 
-    // 4. Initialize random seed separately on each rank
-    //    add the rank to user_seed so that each rank has a different seed
-    unsigned int seed = init_seed(user_seed + rank);
+    // 4. Initialize the random seed on MASTER and share it: every rank draws its own rows
+    //    of the same board, keyed by this seed and the global index of each cell
+    unsigned int seed = init_seed(user_seed);
+    MPI_Bcast(&seed, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
 
     if (rank == 0) {
         // Only the MASTER prints the base user seed and the actual seed used
-        printf("Using base seed: %d (rank 0 uses %u)\n", user_seed, seed);
+        printf("Using base seed: %d (board seed %u)\n", user_seed, seed);
+        if (!pattern_path) {
+            printf("Using density: %g\n", density);
+        }
+        printf("Using engine: %s\n", ENGINE_NAMES[engine]);
+        char rule_text[64];
+        if (engine == ENGINE_LTL) {
+            life_ltl_format_rule(&ltl_rule, rule_text);
+        } else if (engine == ENGINE_LENIA) {
+            life_lenia_format_rule(&lenia_rule, rule_text);
+        } else {
+            life_format_rule(rule, rule_text);
+        }
+        printf("Using rule: %s\n", rule_text);
+        if (pattern_path) {
+            printf("Using pattern: %s (%dx%d)\n", pattern_path, rows, cols);
+        }
+        if (engine != ENGINE_PACKED && engine != ENGINE_HASH && engine != ENGINE_DHASH && engine != ENGINE_SPARSE &&
+            engine != ENGINE_DELTA && engine != ENGINE_LTL && engine != ENGINE_LENIA && engine != ENGINE_ENSEMBLE) {
+            printf("Using kernel: %s\n", life_kernel_name(kernel));
+        }
+        if (engine == ENGINE_HASH) {
+            printf("Using memory cap: %d MiB\n", memory);
+        } else if (engine == ENGINE_DHASH) {
+            printf("Using memory cap: %d MiB per rank (%d ranks)\n", memory, size);
+        }
+        if (engine == ENGINE_TILED) {
+            printf("Using depth: %d (tile %dx%d)\n", depth, LIFE_TILE_ROWS, LIFE_TILE_COLS);
+        }
+        if (engine != ENGINE_HASH && engine != ENGINE_DHASH && engine != ENGINE_GROW) {
+            printf("Using boundary: %s\n", life_boundary_name(boundary));
+        }
     }
 
-    // 5. MASTER allocates and initializes the full board (rows × cols)
-    char *full_board = NULL;
-    if (rank == 0) {
-        full_board = life_create(rows, cols, seed);
-        if (!full_board) {
-            fprintf(stderr, "Error: failed to allocate full board on MASTER.\n");
+    // 5-10. HashLife keeps the whole universe in one quadtree on MASTER
+    if (engine == ENGINE_HASH) {
+        if (size != 1) {
+            if (rank == 0) {
+                fprintf(stderr, "Error: the hashlife engine runs on a single rank (got %d).\n", size);
+            }
             MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
         }
+        run_hashlife(rows, cols, epochs, seed, density, pattern, memory);
+        MPI_Finalize();
+        return 0;
     }
 
-    // 6. Scatter the board row-wise so each rank receives its chunk
-    //    local_buf will point to a padded buffer of size (local_rows + 2) × cols
-    char *local_buf = NULL;
-    int local_rows = 0;
-    mpi_scatter_board(full_board, rows, cols, &local_buf, &local_rows, MPI_COMM_WORLD);
-
-    // Once scattered, MASTER can free the full_board
-    if (rank == 0) {
-        free(full_board);
+    // 5-10. Distributed HashLife: every rank holds a share of the quadtree
+    if (engine == ENGINE_DHASH) {
+        run_dhashlife(rows, cols, epochs, seed, density, pattern, memory);
+        MPI_Finalize();
+        return 0;
     }
 
-    // 7. Allocate two local padded buffers: current and next, each of size (local_rows + 2) × cols
-    int padded_rows = local_rows + 2;
-    size_t buf_elems = (size_t)padded_rows * cols;
-    char *current = malloc(buf_elems * sizeof(char));
-    char *next    = malloc(buf_elems * sizeof(char));
-    if (!current || !next) {
-        fprintf(stderr, "Error: failed to allocate local buffers on rank %d.\n", rank);
-        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    // Slabs exchange their ghost rows along a line of ranks, closed into a ring when rows wrap
+    MPI_Comm comm = mpi_create_line(boundary == LIFE_BOUNDARY_CYLINDER || boundary == LIFE_BOUNDARY_TORUS,
+                                    MPI_COMM_WORLD);
+
+    // 5-10. Ensemble: 64 boards in the bits of every word, each with its own early exits
+    if (engine == ENGINE_ENSEMBLE) {
+        run_ensemble(rows, cols, epochs, seed, density, pattern, comm);
+        MPI_Comm_free(&comm);
+        MPI_Finalize();
+        return 0;
     }
 
-    // 8. Copy scattered real rows into current[1 .. local_rows], leaving ghost rows at indices 0 and local_rows+1
-    //    local_buf itself already has the real rows starting at index cols, so we offset by cols
-    memcpy(current + cols, local_buf + cols, (size_t)local_rows * cols * sizeof(char));
-    free(local_buf);
+    // 5-8. Draw (or scatter) the board and lay out the local padded buffers
+    board_t board = { engine, 0, cols, cols, 1, 1, NULL, NULL, NULL, NULL, NULL, NULL, { 0, 0, 0, 0 }, boundary, NULL };
+    if (engine == ENGINE_LUT2) {
+        board.halo = 2;
+        board.gens = 2;
+    } else if (engine == ENGINE_TILED) {
+        board.halo = depth;     // ghost depth scales with the generations per tile
+        board.gens = depth;
+    } else if (engine == ENGINE_LTL) {
+        board.halo = ltl_rule.radius;   // the neighborhood reaches R rows up and down
+    } else if (engine == ENGINE_LENIA) {
+        board.halo = lenia_rule.radius; // same, for the kernel
+    }
+    if (engine == ENGINE_PACKED) {
+        board_init_packed(&board, rows, cols, seed, density, pattern, comm);
+    } else if (engine == ENGINE_SPARSE) {
+        board_init_list(&board, rows, cols, seed, density, pattern, comm);
+    } else if (engine == ENGINE_DELTA) {
+        board_init_delta(&board, rows, cols, seed, density, pattern, comm);
+    } else if (engine == ENGINE_MORTON) {
+        board_init_morton(&board, rows, cols, seed, density, pattern, comm);
+    } else if (engine == ENGINE_LENIA) {
+        board_init_lenia(&board, rows, cols, seed, density, pattern, &lenia_rule, comm);
+    } else if (engine == ENGINE_MAP) {
+        board_init_map(&board, rows, cols, seed, density, pattern, comm);
+    } else {
+        board_init_byte(&board, rows, cols, seed, density, pattern, comm);
+    }
+    if (engine == ENGINE_ACTIVE) {
+        board.spare = life_alloc(board.local_rows, cols);
+        board.tiles = life_tiles_create(board.local_rows, cols, LIFE_ACTIVE_ROWS, LIFE_ACTIVE_COLS);
+        if (!board.spare || !board.tiles) {
+            fprintf(stderr, "Error: failed to allocate tile tracking on rank %d.\n", rank);
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    } else if (engine == ENGINE_MEMO) {
+        board.memo = life_memo_create(LIFE_MEMO_CAPACITY);
+        if (!board.memo) {
+            fprintf(stderr, "Error: failed to allocate the tile cache on rank %d.\n", rank);
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    } else if (engine == ENGINE_LUT2 || engine == ENGINE_TILED) {
+        board.gen_alive = malloc((size_t)2 * board.gens * sizeof(long));
+        if (!board.gen_alive) {
+            fprintf(stderr, "Error: failed to allocate the per-generation counts on rank %d.\n", rank);
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    } else if (engine == ENGINE_LTL) {
+        board.ltl = life_ltl_create(&ltl_rule, cols);
+        if (!board.ltl) {
+            fprintf(stderr, "Error: failed to allocate the window sums on rank %d.\n", rank);
+            MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        }
+    }
 
-    // Zero out ghost rows:
-    memset(current, 0, cols * sizeof(char));                            // top ghost row
-    memset(current + (local_rows + 1) * cols, 0, cols * sizeof(char));  // bottom ghost row
+    // The grow engine starts from the board at the origin of the plane, with a dead margin
+    long refits = 0;
+    if (engine == ENGINE_GROW) {
+        board.window = (life_window_t){ 0, 0, rows, cols };
+        refits += board_grow(&board, 1, comm);
+    }
 
     // 9. Begin simulation loop with early-exit conditions:
     //    - Zero population
     //    - Steady state (bitwise equality)
-    //    - Alive count unchanged for STABLE_THRESHOLD generations
+    //    - Alive count unchanged for STABLE_THRESHOLD generations (not for the grow
+    //      engine: a glider keeps its count while it flies off, as in run_hashlife())
     
     int stable_count = 0;               // current stable count
     long prev_global_alive = -1;        // no previous alive count yet     
-    const int STABLE_THRESHOLD = 10;    // exit if the same alive count repeats 10 times
     
     double start_time = get_time();
 
-    for (int gen = 1; gen <= epochs; gen++) {
+    int gen = 0;
+    while (gen < epochs) {
         // 9.1 Exchange ghost rows with neighbor ranks
-        mpi_exchange_ghosts(current, local_rows, cols, MPI_COMM_WORLD);
+        board_exchange(&board, comm);
+
+        // 9.2 Compute next generation(s) into 'next'; the fused kernel also
+        //     returns the local population, births, deaths and change flag
+        //     (of the last generation when an engine advances several at once)
+        int step = (epochs - gen < board.gens) ? epochs - gen : board.gens;
+        life_stats_t local_stats, global_stats;
+        board_step(&board, step, &local_stats);
+        gen += step;
 
-        // 9.2 Compute next generation into 'next'
-        life_step(current, next, local_rows, cols);
+        // 9.3 Combine the statistics of all ranks (single collective)
+        mpi_reduce_stats(&local_stats, &global_stats, comm);
+        long global_alive = global_stats.alive;
 
-        // 9.3 Early-exit: check for steady state (no bit changes)
-        if (mpi_check_steady_state(current, next, local_rows, cols, MPI_COMM_WORLD)) {
-            // If steady, count alive cells in the new generation and print then exit
-            long local_alive  = life_count(next + cols, local_rows * cols);
-            long global_alive = mpi_reduce_count(local_alive, MPI_COMM_WORLD);
+        // 9.4 Early-exit: check for steady state (no bit changes)
+        if (!global_stats.changed) {
             if (rank == 0) {
                 printf("Reached steady state at generation %d with %ld alive cells, exiting early.\n",
                        gen, global_alive);
@@ -211,45 +1357,55 @@ int main(int argc, char *argv[]) {
             break;
         }
 
-        // 9.4 Swap buffers: current ← next, next ← current
-        char *tmp = current;
-        current   = next;
-        next      = tmp;
-
-        // 9.5 Gather alive-cell counts
-        long local_alive  = life_count(current + cols, local_rows * cols);
-        long global_alive = mpi_reduce_count(local_alive, MPI_COMM_WORLD);
+        // 9.5 Swap buffers: current ← next, next ← current
+        board_swap(&board);
 
         // 9.6 Early-exit: check for zero population
-        if (mpi_check_zero_population(current, local_rows, cols, MPI_COMM_WORLD)) {
+        if (global_alive == 0) {
             if (rank == 0) {
                 printf("All cells are dead at generation %d, exiting early.\n", gen);
             }
             break;
         }
 
-        // 9.7 Early-exit: alive count unchanged for STABLE_THRESHOLD generations
-        if (rank == 0) {
-            if (prev_global_alive == global_alive) {
+        // 9.7 Grow engine: move the window once the pattern reaches its border
+        //     (and every GROW_PERIOD generations, shrink it if the pattern did)
+        if (engine == ENGINE_GROW) {
+            refits += board_grow(&board, gen % GROW_PERIOD == 0, comm);
+        }
+
+        // 9.8 Early-exit: alive count unchanged for STABLE_THRESHOLD generations
+        //     (every rank holds the global count, so no broadcast is needed).
+        //     A step of several generations compares the count of every one of
+        //     them, otherwise a period-2 oscillator would look steady. The grow
+        //     engine never stops here: its window follows the escaping patterns
+        const long *step_alive = &global_alive;
+        int step_gens = 1;
+        if (step > 1) {
+            mpi_allreduce_counts(board.gen_alive, board.gen_alive + board.gens, step, comm);
+            step_alive = board.gen_alive + board.gens;
+            step_gens  = step;
+        }
+        int stable_gen = 0;
+        for (int g = 0; g < step_gens && !stable_gen; g++) {
+            if (prev_global_alive == step_alive[g]) {
                 stable_count++;
             } else {
                 stable_count = 0;
             }
-            prev_global_alive = global_alive;
+            prev_global_alive = step_alive[g];
+            if (stable_count >= STABLE_THRESHOLD) stable_gen = gen - step_gens + g + 1;
         }
 
-        // Broadcast updated stable_count from MASTER to all ranks
-        MPI_Bcast(&stable_count, 1, MPI_INT, 0, MPI_COMM_WORLD);
-
-        if (stable_count >= STABLE_THRESHOLD) {
+        if (stable_gen && engine != ENGINE_GROW) {
             if (rank == 0) {
                 printf("Alive count stayed at %ld for %d consecutive generations (gen %d), exiting early.\n",
-                       prev_global_alive, STABLE_THRESHOLD, gen);
+                       prev_global_alive, STABLE_THRESHOLD, stable_gen);
             }
             break;
         }
 
-        // 9.8 Print per-generation statistics on MASTER
+        // 9.9 Print per-generation statistics on MASTER
         if (rank == 0) {
             double t_now = get_time();
             printf("[Gen %4d] Alive cells = %ld  Elapsed = %.4f s\n",
@@ -258,18 +1414,38 @@ int main(int argc, char *argv[]) {
     }
 
     // 10. Final summary printed by MASTER
+    long frozen_tiles = 0, total_tiles = 0, memo_hits = 0, memo_misses = 0, memo_empty = 0;
+    if (engine == ENGINE_ACTIVE) {
+        frozen_tiles = mpi_reduce_count(board.tiles->frozen, comm);
+        total_tiles  = mpi_reduce_count((long)board.tiles->tiles_y * board.tiles->tiles_x, comm);
+    } else if (engine == ENGINE_MEMO) {
+        memo_hits   = mpi_reduce_count(board.memo->hits, comm);
+        memo_misses = mpi_reduce_count(board.memo->misses, comm);
+        memo_empty  = mpi_reduce_count(board.memo->empty, comm);
+    }
     if (rank == 0) {
         double total_time = get_time() - start_time;
         printf("Simulation complete on a %dx%d board across %d ranks.\n",
                rows, cols, size);
         printf("Total time: %.4f s  Avg time/gen: %.6f s\n",
                total_time, total_time / epochs);
+        if (engine == ENGINE_ACTIVE) {
+            printf("Frozen period-2 tiles at the last generation: %ld of %ld\n",
+                   frozen_tiles, total_tiles);
+        } else if (engine == ENGINE_GROW) {
+            printf("Window: %dx%d at (%ld, %ld) of the plane after %ld refits\n",
+                   board.window.rows, board.window.cols, board.window.row, board.window.col, refits);
+        } else if (engine == ENGINE_MEMO) {
+            long lookups = memo_hits + memo_misses;
+            printf("Tile cache: %ld hits, %ld misses (%.1f%% hit rate), %ld empty tiles skipped\n",
+                   memo_hits, memo_misses, lookups > 0 ? 100.0 * memo_hits / lookups : 0.0, memo_empty);
+        }
     }
 
     // 11. Cleanup local buffers and finalize MPI
-    free(current);
-    free(next);
+    board_free(&board);
 
+    MPI_Comm_free(&comm);
     MPI_Finalize();
     return 0;
 }
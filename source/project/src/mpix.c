@@ -7,6 +7,7 @@
 //                                                   
 
 #include <time.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -15,58 +16,124 @@
 
 /* ********************************************************************************************* */
 
+/**
+ * @brief Ranks holding the slabs above and below this one.
+ *
+ * Neighbors along the line of a Cartesian communicator from
+ * mpi_create_line() (MPI_PROC_NULL past the edges of a non-periodic one, so
+ * the edge ranks skip that half of the exchange), or the cyclic ring of the
+ * ranks of any other communicator.
+ */
+static void mpi_neighbors(MPI_Comm comm, int *rank_prev, int *rank_next) {
+    int topology;
+    MPI_Topo_test(comm, &topology);
+    if (topology == MPI_CART) {
+        MPI_Cart_shift(comm, 0, 1, rank_prev, rank_next);
+        return;
+    }
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    *rank_prev = (rank - 1 + size) % size;
+    *rank_next = (rank + 1) % size;
+}
+
+MPI_Comm mpi_create_line(int periodic, MPI_Comm comm) {
+    int size;
+    MPI_Comm_size(comm, &size);
+
+    // One dimension with every rank, same ranks as `comm` (no reordering)
+    MPI_Comm line;
+    MPI_Cart_create(comm, 1, &size, &periodic, 0, &line);
+    return line;
+}
+
 void mpi_exchange_ghosts(char *buf,
                          int local_rows,
                          int cols,
+                         int pitch,
                          MPI_Comm comm) {
     
-    // Init current rank 
-    int rank, size;
-    MPI_Comm_rank(comm, &rank);
-    MPI_Comm_size(comm, &size);
-
-    // Get previus and next process rank
-    int rank_prev = (rank - 1 + size) % size;
-    int rank_next = (rank + 1) % size;
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
 
     MPI_Status status;
 
+    // Only the real cells of a row travel (ghost columns and padding stay 0)
+    char *data = buf + 1;
+
     // Send first real row to rank_prev, receive bottom ghost from rank_next
     MPI_Sendrecv(
-        buf + cols,                       // send buffer: first real row
-        cols,                             // send count
-        MPI_CHAR,                         // send datatype
-        rank_prev,                        // dest rank
-        0,                                // send tag
-        buf + (local_rows + 1) * cols,    // recv buffer: bottom ghost
-        cols,                             // recv count
-        MPI_CHAR,                         // recv datatype
-        rank_next,                        // source rank
-        0,                                // recv tag
+        data + pitch,                             // send buffer: first real row
+        cols,                                     // send count
+        MPI_CHAR,                                 // send datatype
+        rank_prev,                                // dest rank
+        0,                                        // send tag
+        data + (size_t)(local_rows + 1) * pitch,  // recv buffer: bottom ghost
+        cols,                                     // recv count
+        MPI_CHAR,                                 // recv datatype
+        rank_next,                                // source rank
+        0,                                        // recv tag
         comm,
         &status
     );
 
     // Send last real row to rank_next, receive top ghost from rank_prev
     MPI_Sendrecv(
-        buf + local_rows * cols,          /* send buffer: last real row */
-        cols,                             /* send count */
-        MPI_CHAR,                         /* send datatype */
-        rank_next,                        /* dest rank */
-        1,                                /* send tag */
-        buf,                              /* recv buffer: top ghost */
-        cols,                             /* recv count */
-        MPI_CHAR,                         /* recv datatype */
-        rank_prev,                        /* source rank */
-        1,                                /* recv tag */
+        data + (size_t)local_rows * pitch,        /* send buffer: last real row */
+        cols,                                     /* send count */
+        MPI_CHAR,                                 /* send datatype */
+        rank_next,                                /* dest rank */
+        1,                                        /* send tag */
+        data,                                     /* recv buffer: top ghost */
+        cols,                                     /* recv count */
+        MPI_CHAR,                                 /* recv datatype */
+        rank_prev,                                /* source rank */
+        1,                                        /* recv tag */
         comm,
         &status
     );
 }
 
+void mpi_exchange_halo(char *buf,
+                       int local_rows,
+                       int cols,
+                       int pitch,
+                       int halo,
+                       MPI_Comm comm) {
+
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
+
+    // `halo` rows of cols real cells, `pitch` bytes apart
+    MPI_Datatype rows_type;
+    MPI_Type_vector(halo, cols, pitch, MPI_CHAR, &rows_type);
+    MPI_Type_commit(&rows_type);
+
+    char *data = buf + 1;
+    MPI_Status status;
+
+    // Send first real rows to rank_prev, receive bottom ghosts from rank_next
+    MPI_Sendrecv(data + (size_t)halo * pitch,                1, rows_type, rank_prev, 0,
+                 data + (size_t)(local_rows + halo) * pitch, 1, rows_type, rank_next, 0,
+                 comm, &status);
+
+    // Send last real rows to rank_next, receive top ghosts from rank_prev
+    MPI_Sendrecv(data + (size_t)local_rows * pitch,          1, rows_type, rank_next, 1,
+                 data,                                       1, rows_type, rank_prev, 1,
+                 comm, &status);
+
+    MPI_Type_free(&rows_type);
+}
+
 void mpi_scatter_board(char *full_board,
                        int rows,
                        int cols,
+                       int pitch,
+                       int halo,
                        char **local,
                        int *local_rows,
                        MPI_Comm comm) {
@@ -88,48 +155,59 @@ void mpi_scatter_board(char *full_board,
         sendcounts = malloc(size * sizeof(int));
         displs     = malloc(size * sizeof(int));
         
+        // Counts and displacements in whole rows, so they fit an int for any board
         int offset = 0, total = 0;
         for (int r = 0; r < size; r++) {
             int r_rows      = base + (r < extra ? 1 : 0);
-            sendcounts[r]   = r_rows * cols;    // number of chars for rank r
-            displs[r]       = offset;           // starting index in full_board
+            sendcounts[r]   = r_rows;           // number of rows for rank r
+            displs[r]       = offset;           // starting row in full_board
             offset         += sendcounts[r];
             total          += sendcounts[r];
         }
 
-        if (total != rows * cols) {
+        if (total != rows) {
             fprintf(stderr,
                     "Error: sum(sendcounts) = %d but expected %d\n",
-                    total, rows * cols);
+                    total, rows);
             MPI_Abort(comm, EXIT_FAILURE);
         }
     }
 
     // Determine how many real rows this rank gets
     *local_rows = base + (rank < extra ? 1 : 0);
-    int padded_elems = (*local_rows + 2) * cols;
 
-    // Allocate padded buffer: two ghost rows + local_rows real rows
-    *local = malloc(padded_elems * sizeof(char));
+    // Allocate aligned padded buffer: halo ghost rows on each side + local_rows real rows,
+    // every row with two ghost columns and padding up to `pitch` (all zero)
+    *local = life_alloc(*local_rows + 2 * (halo - 1), cols);
     if (!*local) {
         fprintf(stderr, "Error: malloc failed in mpi_scatter_board on rank %d\n", rank);
         MPI_Abort(comm, EXIT_FAILURE);
     }
 
-    // Scatter real rows into the middle of *local (skip top ghost row)
-    char *recv_ptr = (*local) + cols;
+    // A real row is cols chars in full_board and lands `pitch` bytes after the previous one
+    MPI_Datatype row_plain, row_padded;
+    MPI_Type_contiguous(cols, MPI_CHAR, &row_plain);
+    MPI_Type_create_resized(row_plain, 0, (MPI_Aint)pitch, &row_padded);
+    MPI_Type_commit(&row_plain);
+    MPI_Type_commit(&row_padded);
+
+    // Scatter real rows into the middle of *local (skip top ghost rows and left ghost column)
+    char *recv_ptr = (*local) + (size_t)halo * pitch + 1;
     MPI_Scatterv(
         full_board,             // send buffer (only valid on MASTER)
-        sendcounts,             // array of sendcounts[r] = (r_rows * cols)
-        displs,                 // array of displacements in full_board
-        MPI_CHAR,               // send datatype
-        recv_ptr,               // recv buffer: &((*local)[cols])
-        (*local_rows) * cols,   // recv count: local_rows * cols
-        MPI_CHAR,               // recv datatype */
+        sendcounts,             // array of sendcounts[r] = r_rows
+        displs,                 // array of row displacements in full_board
+        row_plain,              // send datatype: cols chars
+        recv_ptr,               // recv buffer: &((*local)[halo * pitch + 1])
+        *local_rows,            // recv count: local_rows padded rows
+        row_padded,             // recv datatype: cols chars with a pitch extent
         0,                      // root rank = MASTER */
         comm
     );
 
+    MPI_Type_free(&row_padded);
+    MPI_Type_free(&row_plain);
+
     if (rank == 0) {
         free(sendcounts);
         free(displs);
@@ -160,68 +238,630 @@ long mpi_reduce_count(long local_count, MPI_Comm comm) {
     return (rank == 0) ? global_count : 0;
 }
 
-int mpi_check_steady_state(const char *current,
-                           const char *next,
-                           int local_rows,
+long mpi_allreduce_count(long local_count, MPI_Comm comm) {
+
+    // Same sum as mpi_reduce_count(), delivered to every rank
+    long global_count = 0;
+    MPI_Allreduce(&local_count,     // send buffer: this rank's count
+                  &global_count,    // recv buffer: sum over all ranks
+                  1,                // number of elements to reduce
+                  MPI_LONG,         // datatype of the elements being reduced
+                  MPI_SUM,          // reduction operation
+                  comm);
+
+    return global_count;
+}
+
+void mpi_allreduce_counts(const long *local, long *global, int n, MPI_Comm comm) {
+
+    // Same sum as mpi_allreduce_count(), one element per count
+    MPI_Allreduce(local,            // send buffer: this rank's counts
+                  global,           // recv buffer: element-wise sums over all ranks
+                  n,                // number of elements to reduce
+                  MPI_LONG,         // datatype of the elements being reduced
+                  MPI_SUM,          // reduction operation
+                  comm);
+}
+
+long mpi_exchange_batches(const uint64_t *send,
+                          const int *send_counts,
+                          uint64_t **recv,
+                          int *recv_counts,
+                          long *recv_capacity,
+                          MPI_Comm comm) {
+
+    // Init current rank 
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Every rank learns how many words each other rank sends it
+    MPI_Alltoall(send_counts, 1, MPI_INT, recv_counts, 1, MPI_INT, comm);
+
+    int *sdispls = malloc(size * sizeof(int));
+    int *rdispls = malloc(size * sizeof(int));
+    if (!sdispls || !rdispls) {
+        fprintf(stderr, "Error: malloc failed in mpi_exchange_batches on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    long send_total = 0, recv_total = 0;
+    for (int r = 0; r < size; r++) {
+        send_total += send_counts[r];
+        recv_total += recv_counts[r];
+    }
+
+    // MPI_Alltoallv takes int displacements: a superstep must stay below 2^31 words per rank
+    if (send_total > INT_MAX || recv_total > INT_MAX) {
+        fprintf(stderr, "Error: superstep of %ld words sent, %ld received on rank %d exceeds "
+                        "the %d words of an MPI displacement\n", send_total, recv_total, rank, INT_MAX);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+    for (int r = 0, sdispl = 0, rdispl = 0; r < size; r++) {
+        sdispls[r] = sdispl;
+        rdispls[r] = rdispl;
+        sdispl    += send_counts[r];
+        rdispl    += recv_counts[r];
+    }
+
+    // Grow the receive buffer geometrically so that supersteps rarely reallocate
+    if (recv_total > *recv_capacity) {
+        long capacity = *recv_capacity > 0 ? *recv_capacity : 1024;
+        while (capacity < recv_total) capacity *= 2;
+
+        uint64_t *grown = realloc(*recv, (size_t)capacity * sizeof(uint64_t));
+        if (!grown) {
+            fprintf(stderr, "Error: realloc failed in mpi_exchange_batches on rank %d\n", rank);
+            MPI_Abort(comm, EXIT_FAILURE);
+        }
+        *recv          = grown;
+        *recv_capacity = capacity;
+    }
+
+    MPI_Alltoallv(send,  send_counts, sdispls, MPI_UINT64_T,
+                  *recv, recv_counts, rdispls, MPI_UINT64_T,
+                  comm);
+
+    free(sdispls);
+    free(rdispls);
+    return recv_total;
+}
+
+void mpi_reduce_stats(const life_stats_t *local,
+                      life_stats_t *global,
+                      MPI_Comm comm) {
+
+    // Pack the counters so that a single collective carries all of them
+    long send[4] = { local->alive, local->births, local->deaths, local->changed ? 1 : 0 };
+    long recv[4] = { 0, 0, 0, 0 };
+
+    MPI_Allreduce(send,          // send buffer: this rank's counters
+                  recv,          // recv buffer: sums over all ranks
+                  4,             // alive, births, deaths, changed
+                  MPI_LONG,      // datatype of each element
+                  MPI_SUM,       // sum (changed > 0 iff some rank changed)
+                  comm);
+
+    global->alive   = recv[0];
+    global->births  = recv[1];
+    global->deaths  = recv[2];
+    global->changed = recv[3] > 0;
+}
+
+void mpi_reduce_lanes(const life_lanes_t *local,
+                      life_lanes_t *global,
+                      MPI_Comm comm) {
+
+    // Populations first, then one 0/1 change counter per lane
+    long send[2 * LIFE_LANES], recv[2 * LIFE_LANES];
+    for (int k = 0; k < LIFE_LANES; k++) {
+        send[k]              = local->alive[k];
+        send[LIFE_LANES + k] = (long)((local->changed >> k) & 1);
+    }
+
+    MPI_Allreduce(send, recv, 2 * LIFE_LANES, MPI_LONG, MPI_SUM, comm);
+
+    global->changed = 0;
+    for (int k = 0; k < LIFE_LANES; k++) {
+        global->alive[k] = recv[k];
+        if (recv[LIFE_LANES + k] > 0) global->changed |= UINT64_C(1) << k;
+    }
+}
+
+void mpi_exchange_ghosts_packed(uint64_t *buf,
+                                int local_rows,
+                                int stride,
+                                MPI_Comm comm) {
+
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
+
+    MPI_Status status;
+
+    // Send first real row to rank_prev, receive bottom ghost from rank_next
+    MPI_Sendrecv(buf + stride,                            stride, MPI_UINT64_T, rank_prev, 0,
+                 buf + (size_t)(local_rows + 1) * stride, stride, MPI_UINT64_T, rank_next, 0,
+                 comm, &status);
+
+    // Send last real row to rank_next, receive top ghost from rank_prev
+    MPI_Sendrecv(buf + (size_t)local_rows * stride,       stride, MPI_UINT64_T, rank_next, 1,
+                 buf,                                     stride, MPI_UINT64_T, rank_prev, 1,
+                 comm, &status);
+}
+
+void mpi_exchange_ghosts_list(life_list_t *list, MPI_Comm comm) {
+
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
+
+    MPI_Status status;
+
+    // Alive columns of the first and last real rows
+    const int *first = list->cell + list->start[0];
+    const int *last  = list->cell + list->start[list->rows - 1];
+    int n_first = (int)(list->start[1] - list->start[0]);
+    int n_last  = (int)(list->start[list->rows] - list->start[list->rows - 1]);
+
+    // Send first real row to rank_prev, receive bottom ghost from rank_next
+    // (a row has at most cols alive cells, the actual count comes with the message)
+    MPI_Sendrecv(first,          n_first,    MPI_INT, rank_prev, 0,
+                 list->ghost[1], list->cols, MPI_INT, rank_next, 0,
+                 comm, &status);
+    MPI_Get_count(&status, MPI_INT, &list->ghost_count[1]);
+
+    // Send last real row to rank_next, receive top ghost from rank_prev
+    MPI_Sendrecv(last,           n_last,     MPI_INT, rank_next, 1,
+                 list->ghost[0], list->cols, MPI_INT, rank_prev, 1,
+                 comm, &status);
+    MPI_Get_count(&status, MPI_INT, &list->ghost_count[0]);
+}
+
+void mpi_exchange_ghosts_delta(life_delta_t *delta, MPI_Comm comm) {
+
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
+
+    MPI_Status status;
+
+    // Send flips of the first real row to rank_prev, receive bottom ghost flips from rank_next
+    MPI_Sendrecv(delta->edge_flips[0],  delta->edge_flip_count[0], MPI_INT, rank_prev, 0,
+                 delta->ghost_flips[1], delta->cols,               MPI_INT, rank_next, 0,
+                 comm, &status);
+    MPI_Get_count(&status, MPI_INT, &delta->ghost_flip_count[1]);
+
+    // Send flips of the last real row to rank_next, receive top ghost flips from rank_prev
+    MPI_Sendrecv(delta->edge_flips[1],  delta->edge_flip_count[1], MPI_INT, rank_next, 1,
+                 delta->ghost_flips[0], delta->cols,               MPI_INT, rank_prev, 1,
+                 comm, &status);
+    MPI_Get_count(&status, MPI_INT, &delta->ghost_flip_count[0]);
+}
+
+void mpi_exchange_ghosts_morton(life_morton_t *morton, MPI_Comm comm) {
+
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
+
+    // Boundary rows are spread over the tiles: pack them first
+    life_morton_pack_edges(morton);
+
+    // Send first real row to rank_prev, receive bottom ghost from rank_next
+    MPI_Sendrecv(morton->edge[0],      morton->cols, MPI_CHAR, rank_prev, 0,
+                 morton->ghost[1] + 1, morton->cols, MPI_CHAR, rank_next, 0,
+                 comm, MPI_STATUS_IGNORE);
+
+    // Send last real row to rank_next, receive top ghost from rank_prev
+    MPI_Sendrecv(morton->edge[1],      morton->cols, MPI_CHAR, rank_next, 1,
+                 morton->ghost[0] + 1, morton->cols, MPI_CHAR, rank_prev, 1,
+                 comm, MPI_STATUS_IGNORE);
+}
+
+void mpi_exchange_ghosts_lenia(life_lenia_t *lenia, MPI_Comm comm) {
+
+    // Get previus and next process rank (MPI_PROC_NULL past a non-periodic edge)
+    int rank_prev, rank_next;
+    mpi_neighbors(comm, &rank_prev, &rank_next);
+
+    // `radius` rows of cols floats, contiguous (no ghost columns)
+    int count    = lenia->radius * lenia->cols;
+    float *first = lenia->cell + (size_t)lenia->radius * lenia->cols;
+    float *last  = lenia->cell + (size_t)lenia->rows * lenia->cols;
+    float *below = lenia->cell + (size_t)(lenia->rows + lenia->radius) * lenia->cols;
+
+    // Send first real rows to rank_prev, receive bottom ghosts from rank_next
+    MPI_Sendrecv(first,       count, MPI_FLOAT, rank_prev, 0,
+                 below,       count, MPI_FLOAT, rank_next, 0,
+                 comm, MPI_STATUS_IGNORE);
+
+    // Send last real rows to rank_next, receive top ghosts from rank_prev
+    MPI_Sendrecv(last,        count, MPI_FLOAT, rank_next, 1,
+                 lenia->cell, count, MPI_FLOAT, rank_prev, 1,
+                 comm, MPI_STATUS_IGNORE);
+}
+
+void mpi_scatter_board_packed(uint64_t *full_board,
+                              int rows,
+                              int words,
+                              uint64_t **local,
+                              int *local_rows,
+                              MPI_Comm comm) {
+
+    // Init current rank 
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Calculate how many rows per rank
+    int base   = rows / size;
+    int extra  = rows % size;
+    int stride = words + 2;
+
+    int *sendcounts = NULL;
+    int *displs     = NULL;
+
+    // Master initialization (counts are expressed in whole rows)
+    if (rank == 0) {
+        sendcounts = malloc(size * sizeof(int));
+        displs     = malloc(size * sizeof(int));
+
+        int offset = 0;
+        for (int r = 0; r < size; r++) {
+            sendcounts[r] = base + (r < extra ? 1 : 0);
+            displs[r]     = offset;
+            offset       += sendcounts[r];
+        }
+    }
+
+    // Determine how many real rows this rank gets
+    *local_rows = base + (rank < extra ? 1 : 0);
+
+    // Allocate zeroed padded buffer: ghost rows and ghost words stay 0
+    *local = calloc((size_t)(*local_rows + 2) * stride, sizeof(uint64_t));
+    if (!*local) {
+        fprintf(stderr, "Error: calloc failed in mpi_scatter_board_packed on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    // A plain row on MASTER is `words` contiguous words...
+    MPI_Datatype row_plain;
+    MPI_Type_contiguous(words, MPI_UINT64_T, &row_plain);
+    MPI_Type_commit(&row_plain);
+
+    // ...while a padded row is the same words followed by the two ghost words
+    MPI_Datatype row_padded;
+    MPI_Type_create_resized(row_plain, 0, (MPI_Aint)stride * sizeof(uint64_t), &row_padded);
+    MPI_Type_commit(&row_padded);
+
+    // Scatter real rows, skipping top ghost row and left ghost word
+    MPI_Scatterv(full_board, sendcounts, displs, row_plain,
+                 (*local) + stride + 1, *local_rows, row_padded,
+                 0, comm);
+
+    MPI_Type_free(&row_padded);
+    MPI_Type_free(&row_plain);
+
+    if (rank == 0) {
+        free(sendcounts);
+        free(displs);
+    }
+}
+
+/**
+ * @brief First row of `rank` when `rows` rows are split as in mpi_scatter_board().
+ */
+static long mpi_row_start(int rows, int rank, int size) {
+    int base  = rows / size;
+    int extra = rows % size;
+    return (long)rank * base + (rank < extra ? rank : extra);
+}
+
+void mpi_scatter_board_map(const char *pattern,
+                           int rows,
                            int cols,
+                           unsigned int seed,
+                           double density,
+                           const char *dir,
+                           life_map_t **map,
                            MPI_Comm comm) {
-    int local_changed = 0;
-
-    // Loop over each real row, break early if a change is found
-    for (int i = 1; i <= local_rows && !local_changed; i++) {
-        for (int j = 0; j < cols; j++) {
-            // Compare cell at (i,j) in current and next buffers
-            if (next[i * cols + j] != current[i * cols + j]) {
-                local_changed = 1;  // Mark that this rank has at least one changed cell
-                break;
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Every rank maps its slab (all cells dead)
+    long first     = mpi_row_start(rows, rank, size);
+    int local_rows = (int)(mpi_row_start(rows, rank + 1, size) - first);
+    *map = life_map_create(local_rows, cols, dir);
+    if (!*map) {
+        fprintf(stderr, "Error: cannot map the out-of-core slab on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+    char *cells = (*map)->current;
+    int pitch   = (*map)->pitch;
+    int band    = (*map)->band;
+
+    // Only MASTER knows whether a pattern was loaded
+    int loaded = rank == 0 && pattern != NULL;
+    MPI_Bcast(&loaded, 1, MPI_INT, 0, comm);
+
+    // A random board is drawn by every rank straight into its own file, as in mpi_random_board()
+    if (!loaded) {
+        unsigned int attempt = 0;
+        while (mpi_allreduce_count(life_random(cells + pitch + 1, first, local_rows, cols, (size_t)pitch,
+                                               seed, attempt, density), comm) == 0) {
+            attempt++;
+        }
+        return;
+    }
+
+    // MASTER stages one band of plain rows of the pattern
+    char *staged = NULL;
+    if (rank == 0) {
+        staged = malloc((size_t)band * cols);
+        if (!staged) {
+            fprintf(stderr, "Error: malloc failed in mpi_scatter_board_map on rank %d\n", rank);
+            MPI_Abort(comm, EXIT_FAILURE);
+        }
+    }
+
+    // A real row lands `pitch` bytes after the previous one
+    MPI_Datatype row_plain, row_padded;
+    MPI_Type_contiguous(cols, MPI_CHAR, &row_plain);
+    MPI_Type_create_resized(row_plain, 0, (MPI_Aint)pitch, &row_padded);
+    MPI_Type_commit(&row_padded);
+    MPI_Type_free(&row_plain);
+
+    for (int r = 0; r < size; r++) {
+        long r_first = mpi_row_start(rows, r, size);
+        int r_rows   = (int)(mpi_row_start(rows, r + 1, size) - r_first);
+
+        for (int i = 0; i < r_rows; i += band) {
+            int n = r_rows - i < band ? r_rows - i : band;
+            if (rank == 0) {
+                memcpy(staged, pattern + (size_t)(r_first + i) * cols, (size_t)n * cols);
+                if (r == 0) {
+                    for (int k = 0; k < n; k++) {
+                        memcpy(cells + (size_t)(i + k + 1) * pitch + 1, staged + (size_t)k * cols, cols);
+                    }
+                } else {
+                    MPI_Send(staged, n * cols, MPI_CHAR, r, 0, comm);
+                }
+            } else if (rank == r) {
+                MPI_Recv(cells + (size_t)(i + 1) * pitch + 1, n, row_padded, 0, 0, comm, MPI_STATUS_IGNORE);
             }
         }
     }
 
-    int global_changed = 0;
-    // Perform a logical OR reduction across all ranks:
-    // if any rank's local_changed == 1, then global_changed becomes 1
-    MPI_Allreduce(&local_changed,    // send buffer (int: 0 or 1)
-                  &global_changed,   // receive buffer (int: result of MPI_LOR)
-                  1,                 // number of elements
-                  MPI_INT,           // datatype of each element
-                  MPI_LOR,           // logical OR operation
-                  comm);             // communicator
+    MPI_Type_free(&row_padded);
+    free(staged);
+}
+
+void mpi_random_board(int rows,
+                      int cols,
+                      int halo,
+                      unsigned int seed,
+                      double density,
+                      char **local,
+                      int *local_rows,
+                      MPI_Comm comm) {
 
-    // If no rank detected a change (global_changed == 0), the board is stable
-    // Return 1 for stable, 0 for changed
-    return (global_changed == 0) ? 1 : 0; // 1 = stable, 0 = changed
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Same rows and same padded layout as mpi_scatter_board()
+    long first  = mpi_row_start(rows, rank, size);
+    *local_rows = (int)(mpi_row_start(rows, rank + 1, size) - first);
+    *local      = life_alloc(*local_rows + 2 * (halo - 1), cols);
+    if (!*local) {
+        fprintf(stderr, "Error: malloc failed in mpi_random_board on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    // Rejection sampling of life_create(): draw the next attempt while every cell is dead
+    int pitch   = life_pitch(cols);
+    char *cells = *local + (size_t)halo * pitch + 1;
+    unsigned int attempt = 0;
+    while (mpi_allreduce_count(life_random(cells, first, *local_rows, cols, (size_t)pitch,
+                                           seed, attempt, density), comm) == 0) {
+        attempt++;
+    }
 }
 
-int mpi_check_zero_population(const char *current,
-                              int local_rows,
-                              int cols,
-                              MPI_Comm comm) {
-    long local_alive = 0;
-    
-    // Count alive cells in real rows only (rows 1..local_rows)
-    for (int i = 1; i <= local_rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            // Increment if this cell is alive (value == 1)
-            local_alive += (current[i * cols + j] == 1);
+void mpi_random_board_packed(int rows,
+                             int cols,
+                             unsigned int seed,
+                             double density,
+                             uint64_t **local,
+                             int *local_rows,
+                             MPI_Comm comm) {
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Same rows and same padded layout as mpi_scatter_board_packed()
+    int stride  = life_packed_words(cols) + 2;
+    long first  = mpi_row_start(rows, rank, size);
+    *local_rows = (int)(mpi_row_start(rows, rank + 1, size) - first);
+    *local      = calloc((size_t)(*local_rows + 2) * stride, sizeof(uint64_t));
+    if (!*local) {
+        fprintf(stderr, "Error: calloc failed in mpi_random_board_packed on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    uint64_t *words = *local + stride + 1;
+    unsigned int attempt = 0;
+    while (mpi_allreduce_count(life_random_packed(words, first, *local_rows, cols, (size_t)stride,
+                                                  seed, attempt, density), comm) == 0) {
+        attempt++;
+    }
+}
+
+void mpi_random_board_ensemble(int rows,
+                               int cols,
+                               unsigned int seed,
+                               double density,
+                               uint64_t **local,
+                               int *local_rows,
+                               MPI_Comm comm) {
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Same rows and same padded layout as mpi_scatter_board_packed() with one word per cell
+    int stride  = cols + 2;
+    long first  = mpi_row_start(rows, rank, size);
+    *local_rows = (int)(mpi_row_start(rows, rank + 1, size) - first);
+    *local      = calloc((size_t)(*local_rows + 2) * stride, sizeof(uint64_t));
+    if (!*local) {
+        fprintf(stderr, "Error: calloc failed in mpi_random_board_ensemble on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+
+    // Lane k is the board of seed + k; only the lanes still all dead are drawn again
+    uint64_t *words = *local + stride + 1;
+    unsigned int attempt = 0;
+    uint64_t pending = ~UINT64_C(0);
+    while (pending) {
+        long alive[LIFE_LANES] = { 0 }, global[LIFE_LANES];
+        for (int k = 0; k < LIFE_LANES; k++) {
+            if (!(pending >> k & 1)) continue;
+            alive[k] = life_random_lane(words, first, *local_rows, cols, (size_t)stride, k,
+                                        seed + (unsigned int)k, attempt, density);
+        }
+        MPI_Allreduce(alive, global, LIFE_LANES, MPI_LONG, MPI_SUM, comm);
+        for (int k = 0; k < LIFE_LANES; k++) {
+            if (global[k] > 0) pending &= ~(UINT64_C(1) << k);
+        }
+        attempt++;
+    }
+}
+
+void mpi_window_bounds(const char *buf,
+                       int local_rows,
+                       const life_window_t *window,
+                       long box[4],
+                       MPI_Comm comm) {
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Local box in plane coordinates; an empty slab is neutral for the minimum
+    int local[4];
+    life_bounds(buf, local_rows, window->cols, life_pitch(window->cols), local);
+
+    long send[4] = { LONG_MAX, LONG_MAX, LONG_MAX, LONG_MAX };
+    if (local[2] >= 0) {
+        long first = window->row + mpi_row_start(window->rows, rank, size);
+        send[0] =   first + local[0];
+        send[1] =   window->col + local[1];
+        send[2] = -(first + local[2]);
+        send[3] = -(window->col + local[3]);
+    }
+
+    long recv[4];
+    MPI_Allreduce(send, recv, 4, MPI_LONG, MPI_MIN, comm);
+
+    box[0] =  recv[0];
+    box[1] =  recv[1];
+    box[2] = -recv[2];
+    box[3] = -recv[3];
+}
+
+void mpi_regrid_board(char **buf,
+                      int *local_rows,
+                      const life_window_t *from,
+                      const life_window_t *to,
+                      MPI_Comm comm) {
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    int *send_counts = malloc(4 * size * sizeof(int));
+    if (!send_counts) {
+        fprintf(stderr, "Error: malloc failed in mpi_regrid_board on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+    int *send_displs = send_counts + size;
+    int *recv_counts = send_counts + 2 * size;
+    int *recv_displs = send_counts + 3 * size;
+
+    // Plane rows of this rank before and after, and the columns both windows share
+    long old_lo = from->row + mpi_row_start(from->rows, rank, size);
+    long old_hi = from->row + mpi_row_start(from->rows, rank + 1, size);
+    long new_lo = to->row + mpi_row_start(to->rows, rank, size);
+    long new_hi = to->row + mpi_row_start(to->rows, rank + 1, size);
+    long col_lo = from->col > to->col ? from->col : to->col;
+    long col_hi = from->col + from->cols < to->col + to->cols ? from->col + from->cols : to->col + to->cols;
+    int old_pitch = life_pitch(from->cols);
+    int new_pitch = life_pitch(to->cols);
+
+    // Rows of this rank that rank r holds after the move (counted in new rows)...
+    int total = 0;
+    for (int r = 0; r < size; r++) {
+        long lo = to->row + mpi_row_start(to->rows, r, size);
+        long hi = to->row + mpi_row_start(to->rows, r + 1, size);
+        if (lo < old_lo) lo = old_lo;
+        if (hi > old_hi) hi = old_hi;
+        send_counts[r] = hi > lo ? (int)(hi - lo) : 0;
+        send_displs[r] = total;
+        total         += send_counts[r];
+    }
+
+    // ...and rows of rank r that this rank holds after the move (counted in padded rows)
+    for (int r = 0; r < size; r++) {
+        long lo = from->row + mpi_row_start(from->rows, r, size);
+        long hi = from->row + mpi_row_start(from->rows, r + 1, size);
+        if (lo < new_lo) lo = new_lo;
+        if (hi > new_hi) hi = new_hi;
+        recv_counts[r] = hi > lo ? (int)(hi - lo) : 0;
+        recv_displs[r] = hi > lo ? (int)(lo - new_lo) : 0;
+    }
+
+    // Cut (or extend with dead cells) the outgoing rows to the new columns
+    char *send = calloc(total > 0 ? (size_t)total * to->cols : 1, 1);
+    char *next = life_alloc((int)(new_hi - new_lo), to->cols);
+    if (!send || !next) {
+        fprintf(stderr, "Error: malloc failed in mpi_regrid_board on rank %d\n", rank);
+        MPI_Abort(comm, EXIT_FAILURE);
+    }
+    if (col_hi > col_lo) {
+        for (int r = 0; r < size; r++) {
+            long lo = to->row + mpi_row_start(to->rows, r, size);
+            if (lo < old_lo) lo = old_lo;
+            for (int k = 0; k < send_counts[r]; k++) {
+                const char *src = *buf + (size_t)(lo + k - old_lo + 1) * old_pitch + 1 + (col_lo - from->col);
+                char *dst       = send + (size_t)(send_displs[r] + k) * to->cols + (col_lo - to->col);
+                memcpy(dst, src, (size_t)(col_hi - col_lo));
+            }
         }
     }
 
-    // If no alive cells found locally, set local_zero = 1; else 0
-    int local_zero = (local_alive == 0) ? 1 : 0;
-    int global_zero = 0;
+    // A received row lands `new_pitch` bytes after the previous one (past the left ghost column)
+    MPI_Datatype row_plain, row_padded;
+    MPI_Type_contiguous(to->cols, MPI_CHAR, &row_plain);
+    MPI_Type_create_resized(row_plain, 0, (MPI_Aint)new_pitch, &row_padded);
+    MPI_Type_commit(&row_plain);
+    MPI_Type_commit(&row_padded);
+
+    MPI_Alltoallv(send, send_counts, send_displs, row_plain,
+                  next + new_pitch + 1, recv_counts, recv_displs, row_padded, comm);
 
-    // Perform a logical AND reduction across all ranks:
-    // if every rank has local_zero == 1, global_zero becomes 1
-    MPI_Allreduce(&local_zero,    // send buffer (int: 0 or 1)
-                  &global_zero,   // receive buffer (int: result of MPI_LAND)
-                  1,              // number of elements to reduce
-                  MPI_INT,        // datatype of each element
-                  MPI_LAND,       // logical AND operation
-                  comm);          // communicator
+    MPI_Type_free(&row_padded);
+    MPI_Type_free(&row_plain);
+    free(send);
+    free(send_counts);
+    free(*buf);
 
-    // Return 1 if the entire board has zero population (global_zero == 1), else 0
-    return (global_zero == 1) ? 1 : 0; // 1 = zero population, 0 = still alive
+    *buf        = next;
+    *local_rows = (int)(new_hi - new_lo);
 }
 
 /* ********************************************************************************************* */